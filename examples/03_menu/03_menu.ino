@@ -149,7 +149,7 @@ void loop() {
     oled.drawMode(REPLACE);                                     // Режим отрисовки: очистить и поверх
     oled.charSpacing(1);                                        // Межсимвольный интервал 1 пиксель
     oled.scroll(true);                                          // Включение вертикального скроллинга
-    oled.print("Тут могла быть ваша реклама");                  // Текст для вертикального скроллинга
+    oled.printRef("Тут могла быть ваша реклама");               // Текст для вертикального скроллинга (литерал, без копирования)
     oled.drawPrintVert();                                       // Отрисовка накопленного вертикального текста
 
     // ========================================
@@ -176,7 +176,7 @@ void loop() {
             oled.drawMode(INV_AUTO);                            // Режим отрисовки: авто-инверсия
             oled.charSpacing(1);                                // Межсимвольный интервал 1 пиксель
             oled.scroll(true);                                  // Включение горизонтального скроллинга
-            oled.print(menuItems[i]);                           // Текст пункта меню
+            oled.printRef(menuItems[i]);                        // Текст пункта меню (без копирования)
             oled.drawPrint();                                   // Отрисовка накопленного текста
         } else {
             // Обычный пункт меню без рамки
@@ -185,7 +185,7 @@ void loop() {
             oled.drawMode(REPLACE);                             // Режим отрисовки: очистить и поверх  
             oled.charSpacing(1);                                // Межсимвольный интервал 1 пиксель 
             oled.scroll(false);                                 // Отключение горизонтального скроллинга
-            oled.print(menuItems[i]);                           // Текст пункта меню
+            oled.printRef(menuItems[i]);                        // Текст пункта меню (без копирования)
             oled.drawPrint();                                   // Отрисовка накопленного текста
         }
     }
@@ -0,0 +1,105 @@
+/*
+ * Пример 04_font_rle - Сжатые шрифты RLE: размер во flash и цена распаковки
+ *
+ * Демонстрирует:
+ * - Подключение сжатого шрифта (SF_Font_x2_P16_RLE, SF_7Seg_Temper_NM10x14_RLE)
+ * - Сравнение размера данных шрифта: обычный / сжатый
+ * - Замер времени отрисовки одного символа (drawPrint) для обоих вариантов
+ *
+ * Сжатые шрифты создаются утилитой extras/tools/sava_font_rle.py:
+ *   python3 sava_font_rle.py SF_Font_x2_P16.h
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт для подписей
+#include "Fonts/SF_Font_x2_P16.h"               // Обычный шрифт 16px
+#include "Fonts/SF_Font_x2_P16_RLE.h"           // Тот же шрифт, сжатый RLE
+#include "Fonts/SF_7Seg_Temper_NM10x14.h"       // Обычный семисегментный шрифт
+#include "Fonts/SF_7Seg_Temper_NM10x14_RLE.h"   // Тот же шрифт, сжатый RLE
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+#define BENCH_ROUNDS 200                        // Сколько раз перерисовать строку при замере
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+// Время отрисовки одного символа в наносекундах
+uint32_t benchGlyph(const savaFont &font, const char* text, uint8_t glyphs) {
+    uint32_t start = micros();
+    for (uint16_t i = 0; i < BENCH_ROUNDS; i++) {
+        oled.cursor(0, 0);
+        oled.font(font);
+        oled.print(text);
+        oled.print(i);                           // Меняем строку, чтобы символы рисовались заново
+        oled.drawPrint();
+    }
+    return (uint64_t)(micros() - start) * 1000 / BENCH_ROUNDS / glyphs;
+}
+
+void report(const char* name, size_t rawSize, size_t rleSize, uint32_t rawNs, uint32_t rleNs) {
+    Serial.printf("%s: данные %u -> %u байт (%u%%), символ %u -> %u нс\n",
+                  name, (unsigned)rawSize, (unsigned)rleSize, (unsigned)(rleSize * 100 / rawSize),
+                  (unsigned)rawNs, (unsigned)rleNs);
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    // Инициализация OLED
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+
+    // --- Замер: строка + номер прохода (до 3 цифр), число символов передаётся в benchGlyph ---
+    uint32_t x2Raw   = benchGlyph(SF_Font_x2_P16, "Привет ABC ", 14);
+    uint32_t x2Rle   = benchGlyph(SF_Font_x2_P16_RLE, "Привет ABC ", 14);
+    uint32_t segRaw  = benchGlyph(SF_7Seg_Temper_NM10x14, "-12.5:+ ", 11);
+    uint32_t segRle  = benchGlyph(SF_7Seg_Temper_NM10x14_RLE, "-12.5:+ ", 11);
+
+    report("SF_Font_x2_P16", sizeof(SF_Font_x2_P16_Data), sizeof(SF_Font_x2_P16_RLE_Data), x2Raw, x2Rle);
+    report("SF_7Seg_Temper_NM10x14", sizeof(SF_7Seg_Temper_NM10x14_Data), sizeof(SF_7Seg_Temper_NM10x14_RLE_Data), segRaw, segRle);
+
+    // --- Результат на экране ---
+    oled.clear();
+    oled.cursor(0, 0);
+    oled.font(SF_Font_x2_P16_RLE);
+    oled.print("Сжатый");
+    oled.drawPrint();
+
+    oled.cursor(0, 20);
+    oled.font(SF_7Seg_Temper_NM10x14_RLE);
+    oled.print("-12.5:+");
+    oled.drawPrint();
+
+    oled.cursor(0, 40);
+    oled.font(SF_Font_P8);
+    oled.print("x2: ");
+    oled.print((uint32_t)sizeof(SF_Font_x2_P16_RLE_Data));
+    oled.print("/");
+    oled.print((uint32_t)sizeof(SF_Font_x2_P16_Data));
+    oled.print(" байт");
+    oled.drawPrint();
+
+    oled.cursor(0, 52);
+    oled.print("символ: ");
+    oled.print(x2Rle);
+    oled.print(" / ");
+    oled.print(x2Raw);
+    oled.print(" нс");
+    oled.drawPrint();
+
+    oled.display();
+}
+
+void loop() {
+}
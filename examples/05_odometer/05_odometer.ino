@@ -0,0 +1,86 @@
+/*
+ * Пример 05_odometer - Числовой индикатор с прокруткой цифр
+ *
+ * Демонстрирует:
+ * - Настройку индикатора numberWidget() на семисегментном шрифте
+ * - Вывод значения drawNumber(): перерисовываются только изменившиеся знакоместа
+ * - Прокрутку цифр вверх, как в механическом счётчике (rollFrames)
+ * - Область изменений (dirtyX / dirtyWidth / dirtyCells) для отладки и частичного обновления
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт для подписей
+#include "Fonts/SF_7Seg_Temper_NM10x14.h"       // Семисегментный шрифт для чисел
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+#define ROLL_FRAMES 4                           // Промежуточных кадров прокрутки цифры
+#define FRAME_MS 30                             // Период кадра анимации, мс
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+NumberWidget temperature;                       // Состояние индикатора температуры
+NumberWidget counter;                           // Состояние индикатора счётчика
+
+float tempValue = 21.5;                         // Имитация датчика
+int32_t counterValue = 0;
+unsigned long lastValueTime = 0;
+unsigned long lastFrameTime = 0;
+
+void setup() {
+    Serial.begin(115200);
+
+    // Инициализация OLED
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+    oled.clear();
+
+    // Подписи рисуются один раз
+    oled.font(SF_Font_P8);
+    oled.cursor(0, 0);
+    oled.print("Температура");
+    oled.drawPrint();
+    oled.cursor(0, 34);
+    oled.print("Счётчик");
+    oled.drawPrint();
+
+    // Индикаторы: 5 знакомест для "-12.5", 6 знакомест для счётчика
+    oled.numberWidget(temperature, 40, 12, SF_7Seg_Temper_NM10x14, 5, ROLL_FRAMES);
+    oled.numberWidget(counter, 40, 46, SF_7Seg_Temper_NM10x14, 6, ROLL_FRAMES);
+}
+
+void loop() {
+    unsigned long now = millis();
+
+    // Новое значение раз в секунду
+    if (now - lastValueTime >= 1000) {
+        lastValueTime = now;
+        tempValue += (random(-10, 11)) / 10.0f;
+        counterValue += random(1, 30);
+    }
+
+    // Кадр анимации: drawNumber() вызывается каждый кадр, пока идёт прокрутка
+    if (now - lastFrameTime >= FRAME_MS) {
+        lastFrameTime = now;
+        bool rolling = oled.drawNumber(temperature, tempValue, 1);
+        rolling |= oled.drawNumber(counter, counterValue);
+
+        if (temperature.dirtyWidth > 0 || counter.dirtyWidth > 0) {
+            Serial.printf("изменено: температура x=%d w=%d, счётчик x=%d w=%d%s\n",
+                          temperature.dirtyX, temperature.dirtyWidth,
+                          counter.dirtyX, counter.dirtyWidth, rolling ? " (прокрутка)" : "");
+            oled.display();
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * Пример 06_display_list - Меню на списке отображения
+ *
+ * Демонстрирует:
+ * - Запись кадра в список отображения (displayList / listBegin / listEnd)
+ * - Перерисовку только изменившихся команд: при смене пункта - рамка выделения и две строки
+ * - Отправку кадра только когда в буфере что-то изменилось
+ * - Отчёт о перерисованных командах и изменённой области (getListRedrawn / getListDirty)
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ *
+ * Подключение кнопок:
+ * Кнопка ВВЕРХ -> GPIO 12 (pull-up)
+ * Кнопка ВНИЗ  -> GPIO 15 (pull-up)
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт меню
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+// Пины кнопок
+#define BTN_UP 12                               // Кнопка ВВЕРХ
+#define BTN_DOWN 15                             // Кнопка ВНИЗ
+
+// Параметры меню
+#define MENU_ITEMS_COUNT 5                      // Количество пунктов меню
+#define MENU_ITEM_HEIGHT 12                     // Высота пункта в пикселях
+#define LIST_ITEMS 16                           // Команд в кадре (с запасом)
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+const char* menuItems[MENU_ITEMS_COUNT] = {
+    "Настройки",
+    "Датчики",
+    "Графики",
+    "Информация",
+    "Wi-Fi"
+};
+
+uint8_t selectedItem = 0;
+unsigned long lastButtonPress = 0;
+
+void setup() {
+    Serial.begin(115200);
+    pinMode(BTN_UP, INPUT_PULLUP);
+    pinMode(BTN_DOWN, INPUT_PULLUP);
+
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+    oled.displayList(LIST_ITEMS);                // Память под список: 16 команд, 256 байт текста
+}
+
+void loop() {
+    if (millis() - lastButtonPress > 200) {
+        if (digitalRead(BTN_UP) == LOW) {
+            lastButtonPress = millis();
+            selectedItem = (selectedItem > 0) ? selectedItem - 1 : MENU_ITEMS_COUNT - 1;
+        }
+        if (digitalRead(BTN_DOWN) == LOW) {
+            lastButtonPress = millis();
+            selectedItem = (selectedItem + 1) % MENU_ITEMS_COUNT;
+        }
+    }
+
+    // Кадр описывается целиком, как обычно - список сам найдёт, что изменилось
+    oled.listBegin();
+    oled.clear();                                // Внутри записи игнорируется
+    oled.rectR(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, 3, REPLACE, NO_FILL);
+    oled.font(SF_Font_P8);
+    oled.drawMode(REPLACE);
+    for (uint8_t i = 0; i < MENU_ITEMS_COUNT; i++) {
+        oled.cursor(6, 2 + i * MENU_ITEM_HEIGHT);
+        oled.printRef(menuItems[i]);             // Текст копируется в список, printRef безопасен
+        oled.drawPrint();
+    }
+    oled.rect(3, 1 + selectedItem * MENU_ITEM_HEIGHT, SCREEN_WIDTH - 6, MENU_ITEM_HEIGHT - 1, INV_AUTO, FILL);
+
+    if (oled.listEnd()) {
+        int16_t x, y, w, h;
+        oled.getListDirty(x, y, w, h);
+        Serial.printf("Перерисовано команд: %u из %u, область %dx%d в (%d, %d)\n",
+                      oled.getListRedrawn(), oled.getListItems(), w, h, x, y);
+        oled.display();                          // Кадр отправляется только при изменениях
+    }
+}
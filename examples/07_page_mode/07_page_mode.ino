@@ -0,0 +1,107 @@
+/*
+ * Пример 07_page_mode - Постраничный режим без кадрового буфера: память против времени
+ *
+ * Демонстрирует:
+ * - Описание кадра списком отображения (displayList / listBegin / listEnd)
+ * - Постраничный режим pageMode(): кадр собирается полосами по 1, 2 или 4 страницы
+ * - Замер памяти буферов (getBufferBytes) и времени сборки и отправки кадра для каждой высоты полосы
+ * - Частичное обновление: при смене значения отправляются только задетые полосы и колонки
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт подписей
+#include "Fonts/SF_Font_x2_P16.h"               // Крупный шрифт значения
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+#define BENCH_ROUNDS 50                         // Кадров в замере
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+float value = 21.5;                             // Имитация датчика
+
+// Кадр целиком: рамка, значение, подписи, индикатор
+void drawScene() {
+    oled.rectR(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, 4, REPLACE, NO_FILL);
+    oled.font(SF_Font_x2_P16);
+    oled.cursor(4, 3);
+    oled.print(value, 1);
+    oled.print(" °C");
+    oled.drawPrint();
+    oled.font(SF_Font_P8);
+    for (uint8_t i = 0; i < 3; i++) {
+        oled.cursor(4, 26 + i * 11);
+        oled.print("Канал ");
+        oled.print(i + 1);
+        oled.drawPrint();
+    }
+    oled.circle(100, 42, 14, REPLACE, FILL);
+    oled.circle(100, 42, 8, INV_AUTO, FILL);
+}
+
+void bench(uint8_t stripPages) {
+    oled.pageMode(stripPages);
+    oled.listBegin();
+    drawScene();
+    oled.listEnd();                              // Первый кадр собирается целиком
+
+    uint32_t start = micros();
+    for (uint8_t i = 0; i < BENCH_ROUNDS; i++) {
+        if (stripPages) {
+            oled.display();                      // Все полосы из списка + отправка
+        } else {
+            oled.listInvalidate();
+            oled.listBegin();
+            drawScene();
+            oled.listEnd();
+            oled.display();
+        }
+    }
+    uint32_t fullUs = (micros() - start) / BENCH_ROUNDS;
+
+    start = micros();
+    for (uint8_t i = 0; i < BENCH_ROUNDS; i++) {
+        value += (i & 1) ? 0.1 : -0.1;           // Меняется только значение
+        oled.listBegin();
+        drawScene();
+        if (oled.listEnd() && !stripPages) oled.display(); // В pageMode listEnd() отправляет сам
+    }
+    uint32_t partUs = (micros() - start) / BENCH_ROUNDS;
+
+    Serial.printf("Полоса %u стр.: буферы %u байт, кадр целиком %u мкс, смена значения %u мкс\n",
+                  stripPages, oled.getBufferBytes(), (unsigned)fullUs, (unsigned)partUs);
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+    oled.displayList(16);                        // Список отображения на 16 команд
+
+    bench(0);                                    // Полный кадровый буфер
+    bench(4);
+    bench(2);
+    bench(1);                                    // Минимум памяти: полоса в одну страницу
+    Serial.printf("Свободно в куче: %u байт\n", (unsigned)ESP.getFreeHeap());
+}
+
+void loop() {
+    value += 0.1;
+    if (value > 30) value = 20;
+    oled.listBegin();
+    drawScene();
+    oled.listEnd();                              // Изменённые полосы уходят на дисплей
+    delay(500);
+}
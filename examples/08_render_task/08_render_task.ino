@@ -0,0 +1,92 @@
+/*
+ * Пример 08_render_task - Потокобезопасный режим: несколько задач рисуют на одном экране
+ *
+ * Демонстрирует:
+ * - Задачу рендера на ядре 1 (renderTask): она владеет кадровым буфером и сама отправляет кадры по I2C
+ * - Порции команд frameBegin / frameEnd из двух задач FreeRTOS и из loop() - каждая обновляет свою область
+ * - Отсутствие «рваных» кадров: порция попадает на экран только целиком
+ * - Счётчики отправленных кадров и отброшенных порций (getRenderFrames / getRenderDropped)
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт подписей
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+// Задача «датчика»: значение и полоса той же длины в верхней области.
+// Строка и полоса рисуются одной порцией - на экране они всегда совпадают.
+void sensorTask(void*) {
+    uint8_t level = 0;
+    for (;;) {
+        level = (level + 3) % 100;
+        oled.frameBegin();
+        oled.rect(0, 0, SCREEN_WIDTH, 21, ERASE, FILL);
+        oled.font(SF_Font_P8);
+        oled.cursor(0, 0);
+        oled.print("Уровень ");
+        oled.print(level);
+        oled.print("%");
+        oled.drawPrint();
+        oled.rect(0, 12, 1 + level * (SCREEN_WIDTH - 1) / 100, 6, REPLACE, FILL);
+        oled.frameEnd();
+        vTaskDelay(pdMS_TO_TICKS(40));
+    }
+}
+
+// Задача «сети»: состояние соединения в средней области
+void networkTask(void*) {
+    uint32_t packets = 0;
+    for (;;) {
+        packets += random(1, 20);
+        oled.frameBegin();
+        oled.rect(0, 22, SCREEN_WIDTH, 20, ERASE, FILL);
+        oled.font(SF_Font_P8);
+        oled.cursor(0, 24);
+        oled.print("Пакетов: ");
+        oled.print(packets);
+        oled.drawPrint();
+        oled.circle(120, 32, 4, REPLACE, packets & 1);  // мигающий индикатор
+        oled.frameEnd();
+        vTaskDelay(pdMS_TO_TICKS(150));
+    }
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+    oled.displayList(32);                        // Очередь команд: 32 команды, 256 байт текста
+    oled.renderTask(1);                          // Рендер и передача - на ядре 1
+
+    xTaskCreatePinnedToCore(sensorTask, "sensor", 4096, nullptr, 1, nullptr, 0);
+    xTaskCreatePinnedToCore(networkTask, "network", 4096, nullptr, 1, nullptr, 0);
+}
+
+void loop() {
+    // loop() - такая же задача: нижняя строка со статистикой рендера
+    oled.frameBegin();
+    oled.rect(0, 44, SCREEN_WIDTH, 20, ERASE, FILL);
+    oled.font(SF_Font_P8);
+    oled.cursor(0, 48);
+    oled.print("Кадров ");
+    oled.print(oled.getRenderFrames());
+    oled.print(" потерь ");
+    oled.print(oled.getRenderDropped());
+    oled.drawPrint();
+    oled.frameEnd();
+    delay(500);
+}
@@ -0,0 +1,71 @@
+/*
+ * Пример 09_command_queue - Очередь команд без блокировок: быстрые производители не ждут I2C
+ *
+ * Демонстрирует:
+ * - Очередь команд фиксированного размера (commandQueue) и отправку без блокировок (post / postNumber / postRect)
+ * - Задачу «датчика», которая обновляет значение и счётчик 1000 раз в секунду: обновления одного
+ *   виджета объединяются, на экран попадает последнее значение
+ * - Работу вместе с задачей рендера (renderTask) - она забирает команды перед каждым кадром
+ * - Счётчики очереди: глубина, пик, отброшенные и объединённые команды
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт подписей
+#include "Fonts/SF_Font_x2_P16.h"               // Крупный шрифт значения
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+// Номера виджетов очереди (1..16)
+#define W_VALUE 1                               // Крупное значение датчика
+#define W_COUNT 2                               // Счётчик обновлений
+#define W_STATS 3                               // Строка статистики
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+// Задача «датчика»: 1000 обновлений в секунду, каждое - две команды без ожидания
+void sensorTask(void*) {
+    float phase = 0;
+    uint32_t updates = 0;
+    for (;;) {
+        phase += 0.01f;
+        float value = 50.0f + 45.0f * sinf(phase);
+        oled.postNumber(W_VALUE, 0, 0, SCREEN_WIDTH, 18, SF_Font_x2_P16, value, 1, StrCenter);
+        oled.postNumber(W_COUNT, 0, 24, SCREEN_WIDTH, 12, SF_Font_P8, ++updates, 0, StrCenter);
+        vTaskDelay(1);
+    }
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+    oled.displayList(8);                         // Хранилище задачи рендера
+    oled.commandQueue(32);                       // Очередь: 32 команды, 16 виджетов
+    oled.renderTask(1);                          // Рендер и передача - на ядре 1
+
+    xTaskCreatePinnedToCore(sensorTask, "sensor", 4096, nullptr, 1, nullptr, 0);
+}
+
+void loop() {
+    // Текст копируется в команду целиком (до SAVA_CMD_TEXT - 1 байт)
+    char line[SAVA_CMD_TEXT];
+    snprintf(line, sizeof(line), "peak %u lost %lu", oled.getQueuePeak(), (unsigned long)oled.getQueueDropped());
+    oled.postText(W_STATS, 0, 48, SCREEN_WIDTH, 12, SF_Font_P8, line);
+
+    Serial.printf("Кадров %lu, объединено %lu, пик %u, потерь %lu\n",
+                  (unsigned long)oled.getRenderFrames(), (unsigned long)oled.getQueueCoalesced(),
+                  oled.getQueuePeak(), (unsigned long)oled.getQueueDropped());
+    delay(1000);
+}
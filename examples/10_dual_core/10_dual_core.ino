@@ -0,0 +1,83 @@
+/*
+ * Пример 10_dual_core - Растеризация тяжёлого кадра на двух ядрах
+ *
+ * Демонстрирует:
+ * - Режим rasterCores(2): кадр делится на две полосы страниц, нижнюю рисует задача на ядре 0
+ * - Тяжёлый кадр из списка отображения: два стрелочных прибора и 24 залитых круга
+ * - Замер времени listEnd() на одном и на двух ядрах
+ * - Границу полос, выбранную по площади команд (getRasterSplit)
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт подписей
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+#define BENCH_FRAMES 100                        // Кадров в одном замере
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+uint32_t frame = 0;
+
+// Стрелочный прибор: шкала из рисок, стрелка в три линии, ступица
+void gauge(int16_t cx, int16_t cy, uint8_t value) {
+    oled.circle(cx, cy, 30, REPLACE, NO_FILL);
+    for (uint8_t a = 0; a <= 180; a += 10) {
+        float r = (a + 180) * DEG_TO_RAD;
+        oled.line(cx + 25 * cosf(r), cy + 25 * sinf(r), cx + 29 * cosf(r), cy + 29 * sinf(r), REPLACE);
+    }
+    float r = (value * 180 / 100 + 180) * DEG_TO_RAD;
+    for (int8_t w = -1; w <= 1; w++) oled.line(cx + w, cy, cx + 22 * cosf(r), cy + 22 * sinf(r), REPLACE);
+    oled.circle(cx, cy, 4, REPLACE, FILL);
+}
+
+// Тяжёлый кадр: фон из залитых кругов (инверсия) и два прибора поверх
+void drawScene() {
+    oled.listBegin();
+    for (uint8_t i = 0; i < 24; i++) {
+        oled.circle((i * 37 + frame) % SCREEN_WIDTH, (i * 23) % SCREEN_HEIGHT, 5 + i % 7, INV_AUTO, FILL);
+    }
+    gauge(32, 34, frame % 100);
+    gauge(96, 34, (frame * 3) % 100);
+    oled.listInvalidate(); // весь кадр рисуется заново - честный замер растеризации
+    oled.listEnd();
+    frame++;
+}
+
+// Среднее время listEnd() в микросекундах
+uint32_t bench() {
+    uint32_t start = micros();
+    for (uint16_t i = 0; i < BENCH_FRAMES; i++) drawScene();
+    return (micros() - start) / BENCH_FRAMES;
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+    oled.displayList(48);                        // Список отображения на 48 команд
+
+    uint32_t oneCore = bench();
+    oled.rasterCores(2);                         // Нижняя полоса - на ядре 0 (loop() работает на ядре 1)
+    uint32_t twoCores = bench();
+
+    Serial.printf("Кадр: 1 ядро %lu мкс, 2 ядра %lu мкс, граница полос - страница %u\n",
+                  (unsigned long)oneCore, (unsigned long)twoCores, oled.getRasterSplit());
+}
+
+void loop() {
+    drawScene();
+    oled.display();
+}
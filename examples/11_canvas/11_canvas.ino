@@ -0,0 +1,108 @@
+/*
+ * Пример 11_canvas - Холсты вне экрана: статичная шкала и спрайт
+ *
+ * Демонстрирует:
+ * - Выделение холста (canvas) и рисование в него обычными функциями (canvasBegin / canvasEnd)
+ * - Шкалу прибора, нарисованную один раз при старте и выводимую каждый кадр (drawCanvas)
+ * - Спрайт, движущийся по произвольным y (не кратным 8), в режиме ADD_UP
+ * - Замер времени: перерисовка шкалы против вывода холста
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт подписей шкалы
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+#define BENCH_FRAMES 200                        // Кадров в одном замере
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+SavaCanvas dial;                                // Шкала прибора 64x64
+SavaCanvas ball;                                // Спрайт 12x12 (высота округлится до 16)
+
+uint32_t frame = 0;
+
+// Шкала: окружность, риски через 10 делений, подписи 0 и 100
+void drawScale() {
+    oled.circle(32, 40, 30, REPLACE, NO_FILL);
+    for (uint8_t a = 0; a <= 180; a += 18) {
+        float r = (a + 180) * DEG_TO_RAD;
+        oled.line(32 + 24 * cosf(r), 40 + 24 * sinf(r), 32 + 29 * cosf(r), 40 + 29 * sinf(r), REPLACE);
+    }
+    oled.font(SF_Font_P8);
+    oled.cursor(2, 44);
+    oled.print("0");
+    oled.drawPrint();
+    oled.cursor(46, 44);
+    oled.print("100");
+    oled.drawPrint();
+}
+
+// Стрелка поверх шкалы
+void drawNeedle(int16_t cx, int16_t cy, uint8_t value) {
+    float r = (value * 180 / 100 + 180) * DEG_TO_RAD;
+    oled.line(cx, cy, cx + 22 * cosf(r), cy + 22 * sinf(r), REPLACE);
+    oled.circle(cx, cy, 3, REPLACE, FILL);
+}
+
+// Кадр: шкала из холста (или заново), стрелка и спрайт
+void drawFrame(bool useCanvas) {
+    oled.clear();
+    if (useCanvas) {
+        oled.drawCanvas(dial, 0, 0);             // 512 байт, по одной записи на байт
+    } else {
+        drawScale();                             // линии, окружность и текст заново
+    }
+    drawNeedle(32, 40, frame % 100);
+    int16_t y = 26 + 24 * sinf(frame * 0.1f);    // y не кратен 8 - холст сдвигается внутри страниц
+    oled.drawCanvas(ball, 70 + frame % 46, y, ADD_UP);
+    frame++;
+}
+
+// Среднее время кадра в микросекундах (без отправки на дисплей)
+uint32_t bench(bool useCanvas) {
+    uint32_t start = micros();
+    for (uint16_t i = 0; i < BENCH_FRAMES; i++) drawFrame(useCanvas);
+    return (micros() - start) / BENCH_FRAMES;
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+
+    // --- Холсты рисуются один раз ---
+    oled.canvas(dial, 64, 64);
+    oled.canvasBegin(dial);
+    drawScale();
+    oled.canvasEnd();
+
+    oled.canvas(ball, 12, 12);
+    oled.canvasBegin(ball);
+    oled.circle(6, 6, 5, REPLACE, FILL);
+    oled.circle(4, 4, 1, ERASE, FILL);            // блик
+    oled.canvasEnd();
+
+    uint32_t redraw = bench(false);
+    uint32_t blit = bench(true);
+    Serial.printf("Кадр: шкала заново %lu мкс, шкала из холста %lu мкс\n",
+                  (unsigned long)redraw, (unsigned long)blit);
+}
+
+void loop() {
+    drawFrame(true);
+    oled.display();
+    delay(30);
+}
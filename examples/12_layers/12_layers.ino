@@ -0,0 +1,99 @@
+/*
+ * Пример 12_layers - Слои: статичный фон рисуется один раз
+ *
+ * Демонстрирует:
+ * - Три слоя (layers): фон, значения и курсор
+ * - Фон с сеткой, рамкой и подписями, нарисованный в слой 0 один раз
+ * - Обновление значений в слое 1 только в своих строках (layerBegin с областью)
+ * - Курсор-инверсию в слое 2 (layerMode INV_AUTO)
+ * - Время кадра и число страниц, собранных из слоёв (getComposedPages)
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт подписей и значений
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+#define LAYER_BACK   0                          // Фон: сетка, рамка, подписи
+#define LAYER_VALUES 1                          // Значения каналов
+#define LAYER_CURSOR 2                          // Курсор выбранного канала
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+uint32_t frame = 0;
+uint8_t cursorRow = 0;
+
+// Фон: рамка, точечная сетка и подписи четырёх каналов
+void drawBackground() {
+    oled.rectR(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, 3, REPLACE, NO_FILL);
+    for (uint8_t x = 8; x < SCREEN_WIDTH; x += 8) {
+        for (uint8_t y = 8; y < SCREEN_HEIGHT; y += 8) oled.dot(x, y, REPLACE);
+    }
+    oled.font(SF_Font_P8);
+    for (uint8_t i = 0; i < 4; i++) {
+        oled.cursor(4, 4 + i * 14);
+        oled.print("Канал ");
+        oled.print(i + 1);
+        oled.drawPrint();
+    }
+}
+
+// Значение канала i - только в строках этого канала
+void drawValue(uint8_t i, int32_t value) {
+    oled.layerBegin(LAYER_VALUES, 4 + i * 14, 10);
+    oled.clear();                                // очищаются только строки канала
+    oled.cursor(70, 4 + i * 14);
+    oled.print(value);
+    oled.drawPrint();
+    oled.layerEnd();
+}
+
+// Курсор: залитая полоса, инвертирующая строку канала
+void drawCursor(uint8_t row) {
+    oled.layerBegin(LAYER_CURSOR);
+    oled.clear();
+    oled.rect(2, 2 + row * 14, SCREEN_WIDTH - 4, 13, REPLACE, FILL);
+    oled.layerEnd();
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+
+    oled.layers(3);                              // 3 КБ: по кадру на слой
+    oled.layerMode(LAYER_CURSOR, INV_AUTO);
+    oled.layerBegin(LAYER_BACK);
+    drawBackground();                            // больше не перерисовывается
+    oled.layerEnd();
+    drawCursor(cursorRow);
+}
+
+void loop() {
+    uint32_t start = micros();
+    drawValue(frame % 4, (int32_t)(frame * 37 % 2000) - 1000);
+    if (frame % 50 == 0) {
+        cursorRow = (cursorRow + 1) % 4;
+        drawCursor(cursorRow);
+    }
+    oled.display();
+    uint32_t elapsed = micros() - start;
+
+    if (frame % 100 == 0) {
+        Serial.printf("Кадр %lu мкс (с отправкой), собрано страниц: %u\n",
+                      (unsigned long)elapsed, oled.getComposedPages());
+    }
+    frame++;
+}
@@ -0,0 +1,84 @@
+/*
+ * Пример 13_region_ops - Операции с областями: подсветка меню и журнал
+ *
+ * Демонстрирует:
+ * - Подсветку пункта меню инверсией области (invertRect)
+ * - Журнал, прокручиваемый сдвигом области на строку вверх (scrollRect):
+ *   каждое новое сообщение рисуется одной строкой, старые не перерисовываются
+ * - Очистку области под сообщение (clearRect)
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт меню и журнала
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+#define MENU_WIDTH 44                           // Меню - слева
+#define MENU_ITEMS 4                            // Пунктов меню
+#define ITEM_HEIGHT 16                          // Высота пункта в пикселях
+#define LOG_X (MENU_WIDTH + 2)                  // Журнал - справа от меню
+#define LOG_LINE 8                              // Высота строки журнала
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+const char* items[MENU_ITEMS] = { "Старт", "Стоп", "Режим", "Сброс" };
+uint8_t selected = 0;
+uint32_t frame = 0;
+
+// Новое сообщение журнала: область сдвигается на строку вверх, внизу - новая строка
+void logLine(const char* text, uint32_t value) {
+    oled.scrollRect(LOG_X, 0, SCREEN_WIDTH - LOG_X, SCREEN_HEIGHT, 0, -LOG_LINE);
+    oled.cursor(LOG_X, SCREEN_HEIGHT - LOG_LINE);
+    oled.print(text);
+    oled.print(value);
+    oled.drawPrint();
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+
+    oled.clear();
+    oled.font(SF_Font_P8);
+    for (uint8_t i = 0; i < MENU_ITEMS; i++) {
+        oled.cursor(2, i * ITEM_HEIGHT + 4);
+        oled.print(items[i]);
+        oled.drawPrint();
+    }
+    oled.vLine(MENU_WIDTH, 0, SCREEN_HEIGHT, REPLACE);
+    oled.invertRect(0, selected * ITEM_HEIGHT, MENU_WIDTH, ITEM_HEIGHT);
+    oled.display();
+}
+
+void loop() {
+    // Каждые 20 кадров - следующий пункт меню: снять подсветку со старого, подсветить новый
+    if (frame % 20 == 0) {
+        oled.invertRect(0, selected * ITEM_HEIGHT, MENU_WIDTH, ITEM_HEIGHT);
+        selected = (selected + 1) % MENU_ITEMS;
+        oled.invertRect(0, selected * ITEM_HEIGHT, MENU_WIDTH, ITEM_HEIGHT);
+        logLine(items[selected], frame);
+    } else if (frame % 5 == 0) {
+        logLine("t=", millis() / 100);
+    }
+
+    // Метка активности в углу журнала: очистка области и новая точка
+    oled.clearRect(SCREEN_WIDTH - 4, 0, 4, 4);
+    oled.dot(SCREEN_WIDTH - 4 + frame % 4, frame % 4, REPLACE);
+
+    oled.display();
+    frame++;
+    delay(100);
+}
@@ -0,0 +1,79 @@
+/*
+ * Пример 14_chart - Бегущий график с обновлением по одной колонке
+ *
+ * Демонстрирует:
+ * - График-линию с автомасштабом и график-столбики в фиксированном диапазоне (chartWidget)
+ * - Новый отсчёт: сдвиг области на колонку влево и одна новая колонка (drawChart)
+ * - Подписи оси в отдельном слое: перерисовываются только при смене диапазона (drawChartAxis)
+ * - Пропуск отсчёта (NAN) - разрыв линии
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт подписей оси
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+#define LAYER_AXIS  0                           // Подписи и оси
+#define LAYER_PLOT  1                           // Графики
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+ChartWidget temperature;                        // Линия, автомасштаб
+ChartWidget load;                               // Столбики, 0..100 %
+
+uint32_t sampleIndex = 0;
+
+// Отсчёт в график: рисование только в строках графика слоя LAYER_PLOT, подписи - при смене диапазона
+void push(ChartWidget &chart, float value, uint8_t decimals) {
+    oled.layerBegin(LAYER_PLOT, chart.y, chart.h);
+    bool rescaled = oled.drawChart(chart, value);
+    oled.layerEnd();
+    if (rescaled) {
+        oled.layerBegin(LAYER_AXIS, chart.y, chart.h + 1);
+        oled.drawChartAxis(chart, SF_Font_P8, decimals);
+        oled.layerEnd();
+    }
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+
+    oled.layers(2);                              // Фон с подписями и слой графиков
+    oled.chartWidget(temperature, 30, 0, 98, 38, CHART_LINE);          // minY == maxY - автомасштаб
+    oled.chartWidget(load, 30, 44, 98, 19, CHART_BAR, 0, 100);
+}
+
+void loop() {
+    // Имитация датчиков: медленная температура с шумом и нагрузка процессора
+    float t = 21.5f + 3.0f * sinf(sampleIndex * 0.05f) + (random(-10, 11) / 20.0f);
+    float cpu = 50 + 45 * sinf(sampleIndex * 0.21f);
+    if (sampleIndex % 90 == 45) t = NAN;        // Пропуск: датчик не ответил
+
+    uint32_t start = micros();
+    push(temperature, t, 1);
+    push(load, cpu, 0);
+    uint32_t drawUs = micros() - start;
+
+    oled.display();                              // Собираются только страницы изменённых строк
+
+    if (sampleIndex % 100 == 0) {
+        Serial.printf("Отсчёт %lu: рисование %lu мкс, собрано страниц: %u\n",
+                      (unsigned long)sampleIndex, (unsigned long)drawUs, oled.getComposedPages());
+    }
+    sampleIndex++;
+    delay(50);
+}
@@ -0,0 +1,93 @@
+/*
+ * Пример 15_popup - Всплывающие окна с сохранением фона
+ *
+ * Демонстрирует:
+ * - Пул под сохранённые области (overlayPool)
+ * - Уведомление поверх работающего экрана: фон под ним сохраняется (pushOverlay)
+ * - Вложенный диалог поверх уведомления, закрытие в обратном порядке
+ * - Закрытие окна: фон возвращается байт в байт, на дисплей уходит только область окна (popOverlay)
+ * - Занятость пула и счётчик переполнений (getOverlayUsed / getOverlayOverflows)
+ *
+ * Подключение OLED дисплея:
+ * SDA -> GPIO 5
+ * SCL -> GPIO 4
+ * VCC -> 3.3V
+ * GND -> GND
+ */
+
+#include "SavaOLED_ESP32.h"                     // Подключение библиотеки SavaOLED_ESP32
+#include "Fonts/SF_Font_P8.h"                   // Шрифт экрана и окон
+
+// Настройки дисплея
+#define SCREEN_WIDTH 128                        // Ширина экрана в пикселях
+#define SCREEN_HEIGHT 64                        // Высота экрана в пикселях
+#define OLED_SDA 5                              // Пин SDA
+#define OLED_SCL 4                              // Пин SCL
+
+// Создание объекта дисплея
+SavaOLED_ESP32 oled(SCREEN_WIDTH, SCREEN_HEIGHT);
+
+uint32_t frame = 0;
+
+// Основной экран: рамка, точечная сетка и счётчик кадров
+void drawScreen() {
+    oled.clear();
+    oled.rect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, REPLACE, NO_FILL);
+    for (uint8_t x = 8; x < SCREEN_WIDTH; x += 8) {
+        for (uint8_t y = 8; y < SCREEN_HEIGHT; y += 8) oled.dot(x, y, REPLACE);
+    }
+    oled.cursor(4, 4);
+    oled.print("Кадр ");
+    oled.print(frame);
+    oled.drawPrint();
+}
+
+// Окно: фон под ним сохраняется, рисование - только внутри прямоугольника окна
+bool openWindow(int16_t x, int16_t y, int16_t w, int16_t h, const char* text) {
+    if (!oled.pushOverlay(x, y, w, h)) return false;
+    oled.clearRect(x, y, w, h);
+    oled.rect(x, y, w, h, REPLACE, NO_FILL);
+    oled.cursor(x + 4, y + 4);
+    oled.print(text);
+    oled.drawPrint();
+    oled.display();
+    return true;
+}
+
+void setup() {
+    Serial.begin(115200);
+
+    oled.init(400000, OLED_SDA, OLED_SCL);       // Инициализация I2C и дисплея
+    oled.setAddress(0x3C);                       // Установка I2C-адреса
+
+    oled.font(SF_Font_P8);
+    oled.overlayPool(512, 2);                    // Два окна, до 512 байт на оба
+}
+
+void loop() {
+    drawScreen();
+    oled.display();
+
+    // Уведомление 96x24 задевает страницы 2-5: сохраняется 4 x 96 = 384 байта
+    if (openWindow(16, 20, 96, 24, "Сохранено")) {
+        delay(800);
+
+        // Диалог поверх уведомления: 2 страницы x 56 байт, всего 496 байт из 512
+        if (openWindow(36, 40, 56, 16, "OK?")) {
+            Serial.printf("Окон: %u, занято пула: %u байт\n",
+                          oled.getOverlayDepth(), oled.getOverlayUsed());
+            delay(800);
+            oled.popOverlay();                   // Вернулось уведомление под диалогом
+            delay(400);
+        }
+        oled.popOverlay();                       // Вернулся основной экран
+    }
+
+    // Окно во весь экран в пул не помещается: push вернёт false, экран просто перерисовывается
+    if (frame % 10 == 0 && !oled.pushOverlay(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT)) {
+        Serial.printf("Переполнений пула: %lu\n", (unsigned long)oled.getOverlayOverflows());
+    }
+
+    frame++;
+    delay(1000);
+}
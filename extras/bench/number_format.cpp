@@ -0,0 +1,127 @@
+// Форматирование чисел print() на ПК: сверка с прежним путём через snprintf и замер скорости.
+//
+//   sh extras/host/build.sh extras/bench/number_format.cpp && /tmp/savaoled_host/number_format
+//
+// Эталон - код print() до перехода на собственное форматирование: строка формата "%0W.Df" / "%0Nld",
+// snprintf в буфер 32 (22 для целых) символа. decimalPlaces больше 9 не сверяются (ограничены до 9).
+#include <chrono>
+#include <random>
+#include <vector>
+#define private public // Доступ к тексту сегмента для сверки
+#include "SavaOLED_ESP32.h"
+
+using Clock = std::chrono::steady_clock;
+
+static std::string reference_double(double value, int decimals, int width) {
+    char buffer[32] = {0}, format[16] = {0};
+    if (width > 0) snprintf(format, sizeof(format), "%%0%d.%df", width, decimals);
+    else snprintf(format, sizeof(format), "%%.%df", decimals);
+    snprintf(buffer, sizeof(buffer), format, value);
+    return buffer;
+}
+
+static std::string reference_integer(long value, int digits, bool is_unsigned) {
+    char buffer[22] = {0}, format[8] = {0};
+    if (digits > 0) {
+        snprintf(format, sizeof(format), is_unsigned ? "%%0%dlu" : "%%0%dld", digits);
+        snprintf(buffer, sizeof(buffer), format, value);
+    } else {
+        snprintf(buffer, sizeof(buffer), is_unsigned ? "%lu" : "%ld", value);
+    }
+    return buffer;
+}
+
+static SavaOLED_ESP32 oled;
+static long g_checked = 0, g_failed = 0;
+
+template <class Print>
+static void check(const std::string &expected, Print print, const char* what) {
+    oled.cursor(0, 0);
+    print();
+    g_checked++;
+    std::string got = oled._segmentCount ? oled._segments[0].text : "<нет сегмента>";
+    if (got != expected && g_failed++ < 20) printf("FAIL %s: '%s', ожидалось '%s'\n", what, got.c_str(), expected.c_str());
+}
+
+static void check_doubles() {
+    std::mt19937_64 rng(1);
+    std::vector<double> values = {
+        0.0, -0.0, 0.125, 0.375, 2.5, 3.5, -2.5, 0.005, 0.015, 0.145, 1.005, 99.995, 123456.789,
+        0.5, 1.5, 9.5, 0.05, 0.95, 4294967295.5, 18446744073709551615.0, 18446744073709551616.0,
+        1e15, 3.7e10, 1e17, 1.7e17, 1e19, 2e19, 1e30, -1e38, 1e300, 1.7976931348623157e308,
+        -1e-300, 5e-324, INFINITY, -INFINITY, NAN, -NAN };
+    for (int i = 0; i < 200000; i++) {
+        uint64_t bits = rng();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        if (i % 3 == 0) value = std::ldexp((double)(rng() % 100000000), (int)(rng() % 120) - 40) * ((rng() & 1) ? -1 : 1);
+        if (i % 3 == 1) value = (double)(int64_t)(rng() % 2000000 - 1000000) / 1000.0;
+        values.push_back(value);
+    }
+    for (double value : values) {
+        for (int decimals = 0; decimals <= 9; decimals++) {
+            for (int width : { 0, 1, 4, 7, 12, 40 }) {
+                check(reference_double(value, decimals, width),
+                      [&] { oled.print(value, (uint8_t)decimals, (uint8_t)width); }, "double");
+                float narrow = (float)value;
+                check(reference_double((double)narrow, decimals, width),
+                      [&] { oled.print(narrow, (uint8_t)decimals, (uint8_t)width); }, "float");
+            }
+        }
+    }
+}
+
+static void check_integers() {
+    std::mt19937_64 rng(2);
+    std::vector<int32_t> values = { 0, 1, -1, 9, 10, -10, INT32_MIN, INT32_MAX, 12345, -12345 };
+    for (int i = 0; i < 100000; i++) values.push_back((int32_t)rng() >> (rng() % 32));
+    for (int32_t value : values) {
+        for (int digits : { 0, 1, 2, 3, 5, 8, 11, 12, 21, 22, 30, 255 }) {
+            check(reference_integer(value, digits, false), [&] { oled.print(value, (uint8_t)digits); }, "int32");
+            check(reference_integer((uint32_t)value, digits, true), [&] { oled.print((uint32_t)value, (uint8_t)digits); }, "uint32");
+        }
+    }
+}
+
+// Прежний print(): строка формата, snprintf, затем print(const char*)
+static void print_snprintf(float value, uint8_t decimals, uint8_t width) {
+    char buffer[32] = {0}, format[16] = {0};
+    snprintf(format, sizeof(format), "%%0%d.%df", width, decimals);
+    snprintf(buffer, sizeof(buffer), format, (double)value);
+    oled.print(buffer);
+}
+
+static void print_snprintf(int32_t value, uint8_t digits) {
+    char buffer[22] = {0}, format[8] = {0};
+    snprintf(format, sizeof(format), "%%0%dld", digits);
+    snprintf(buffer, sizeof(buffer), format, (long)value);
+    oled.print(buffer);
+}
+
+static double bench_ns(bool old_path, bool large) {
+    const int N = 1000000;
+    volatile float base = large ? 3.7e10f : 23.456f;
+    auto start = Clock::now();
+    for (int i = 0; i < N; i++) {
+        oled.cursor(0, 0);
+        float value = base + i * 0.01f;
+        if (old_path) {
+            print_snprintf(value, large ? 9 : 1, 4);
+            print_snprintf((int32_t)i, 3);
+        } else {
+            oled.print(value, large ? 9 : 1, 4);
+            oled.print((int32_t)i, 3);
+        }
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / N;
+}
+
+int main() {
+    check_doubles();
+    check_integers();
+    printf("checked %ld, failed %ld\n", g_checked, g_failed);
+
+    printf("print(float, 1, 4) + print(int32, 3): snprintf %.1f ns, print %.1f ns\n", bench_ns(true, false), bench_ns(false, false));
+    printf("print(3.7e10f, 9, 4) + print(int32, 3): snprintf %.1f ns, print %.1f ns\n", bench_ns(true, true), bench_ns(false, true));
+    return g_failed ? 1 : 0;
+}
@@ -0,0 +1,81 @@
+// Постраничный режим (pageMode) на ПК: память против времени кадра для полос разной высоты.
+// Сцена - типичная приборная панель (рамка, крупное значение, три строки датчиков, круги, bitmap, линия).
+//
+//   sh extras/host/build.sh extras/bench/page_mode.cpp && /tmp/savaoled_host/page_mode
+//
+// 0 страниц - обычный режим с полным кадровым буфером (сцена перерисовывается целиком).
+// RAM - getBufferBytes(): кадр или полоса, буфер передачи, буфер строки и список (размеры структур - как на ПК).
+#include <chrono>
+#include "SavaOLED_ESP32.h"
+#include "Fonts/SF_Font_P8.h"
+#include "Fonts/SF_Font_x2_P16.h"
+
+using Clock = std::chrono::steady_clock;
+
+static uint8_t g_logo[32 * 4];
+
+static void dashboard(SavaOLED_ESP32 &oled, int value) {
+    oled.rectR(0, 0, 128, 64, 4, REPLACE, NO_FILL);
+    oled.font(SF_Font_x2_P16);
+    oled.cursor(4, 3);
+    oled.print("T ");
+    oled.print(value / 10.0f, 1);
+    oled.drawPrint();
+    oled.font(SF_Font_P8);
+    for (int i = 0; i < 3; i++) {
+        oled.cursor(4, 24 + i * 11);
+        oled.print("Датчик ");
+        oled.print(i);
+        oled.print(": ");
+        oled.print(123 + i);
+        oled.drawPrint();
+    }
+    oled.circle(100, 40, 14, REPLACE, FILL);
+    oled.circle(100, 40, 8, INV_AUTO, FILL);
+    oled.drawBitmap(88, 2, g_logo, 32, 20, REPLACE);
+    oled.line(0, 63, 127, 20, INV_AUTO);
+}
+
+static double us_per_frame(Clock::time_point start, int frames) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / frames;
+}
+
+int main() {
+    for (auto &b : g_logo) b = rand();
+    const int N = 5000;
+    printf("strip | RAM, bytes | full frame, us | one value changed, us\n");
+    for (int strip : { 0, 1, 2, 4 }) {
+        SavaOLED_ESP32 oled(128, 64, I2C_NUM_0, strip); // Полоса задаётся до выделения буферов
+        oled.init(400000, 5, 4);
+        oled.displayList(24, 256);
+        oled.listBegin();
+        dashboard(oled, 123);
+        oled.listEnd();
+
+        // Полный кадр: в постраничном режиме - проход списка по всем полосам с отправкой
+        auto start = Clock::now();
+        for (int i = 0; i < N; i++) {
+            if (strip) {
+                oled.display();
+            } else {
+                oled.listInvalidate();
+                oled.listBegin();
+                dashboard(oled, 123);
+                oled.listEnd();
+            }
+        }
+        double full = us_per_frame(start, N);
+
+        // Изменилась одна цифра: перерисовываются и отправляются только затронутые страницы
+        start = Clock::now();
+        for (int i = 0; i < N; i++) {
+            oled.listBegin();
+            dashboard(oled, 123 + (i & 1));
+            oled.listEnd();
+        }
+        double partial = us_per_frame(start, N);
+
+        printf("%5d | %10u | %14.1f | %21.1f\n", strip, oled.getBufferBytes(), full, partial);
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Растеризация на двух ядрах (rasterCores) на ПК: масштабирование на тяжёлых кадрах.
+//
+//   sh extras/host/build.sh extras/bench/raster_cores.cpp && /tmp/savaoled_host/raster_cores
+//
+// Для каждой сцены: один поток; каждая полоса по отдельности (оценка для двух настоящих ядер -
+// время большей полосы); два потока std::thread через rasterCores(2). На ПК второй поток будится
+// через mutex/condition_variable, поэтому на лёгких кадрах накладные расходы заметнее, чем на ESP32.
+#include <chrono>
+#include <cmath>
+#define private public // Доступ к _rasterRegions для замера полос
+#include "SavaOLED_ESP32.h"
+#include "Fonts/SF_Font_x2_P16.h"
+
+using Clock = std::chrono::steady_clock;
+
+static uint8_t g_dither[128 * 8];
+
+static double us_since(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+static void scene(SavaOLED_ESP32 &oled, int kind, int frame) {
+    oled.listBegin();
+    if (kind == 0) {
+        // Много залитых кругов
+        for (int i = 0; i < 40; i++) oled.circle((i * 37 + frame) % 128, (i * 23) % 64, 6 + i % 9, INV_AUTO, FILL);
+    } else if (kind == 1) {
+        // Растр с дизерингом и крупное число
+        oled.drawBitmap(0, 0, g_dither, 128, 64, REPLACE);
+        oled.font(SF_Font_x2_P16);
+        oled.cursor(0, 24, StrCenter);
+        oled.print(frame);
+        oled.drawPrint();
+    } else {
+        // Два стрелочных прибора: шкала из линий, толстая стрелка, табло
+        for (int g = 0; g < 2; g++) {
+            int cx = 32 + g * 64, cy = 32;
+            oled.circle(cx, cy, 30, REPLACE, NO_FILL);
+            for (int a = 0; a <= 180; a += 6) {
+                double r = (a + 180) * M_PI / 180;
+                oled.line(cx + 26 * cos(r), cy + 26 * sin(r), cx + 30 * cos(r), cy + 30 * sin(r), REPLACE);
+            }
+            double r = ((frame * 7 + g * 90) % 180 + 180) * M_PI / 180;
+            for (int w = -1; w <= 1; w++) oled.line(cx + w, cy, cx + 24 * cos(r), cy + 24 * sin(r), REPLACE);
+            oled.circle(cx, cy, 4, REPLACE, FILL);
+            oled.rectR(cx - 20, cy + 12, 40, 16, 4, ERASE_BORDER, FILL);
+        }
+    }
+    oled.listInvalidate(); // Каждый кадр - полный
+    oled.listEnd();
+}
+
+int main() {
+    for (int x = 0; x < 128; x++) {
+        for (int p = 0; p < 8; p++) g_dither[p * 128 + x] = ((x + p) & 1) ? 0xAA : 0x55;
+    }
+    const char* names[] = { "40 filled circles", "dithered bitmap+text", "two gauges" };
+    const int N = 400;
+    for (int kind = 0; kind < 3; kind++) {
+        SavaOLED_ESP32 one, two;
+        one.displayList(64, 256);
+        two.displayList(64, 256);
+        two.rasterCores(2);
+        scene(one, kind, 0);
+        scene(two, kind, 0);
+
+        auto start = Clock::now();
+        for (int f = 0; f < N; f++) scene(one, kind, f);
+        double single = us_since(start) / N;
+        start = Clock::now();
+        for (int f = 0; f < N; f++) scene(two, kind, f);
+        double threads = us_since(start) / N;
+
+        // Полосы последнего кадра по отдельности
+        uint8_t split = two.getRasterSplit();
+        const int16_t full[1][4] = { { 0, 0, 128, 64 } };
+        start = Clock::now();
+        for (int f = 0; f < N; f++) one._rasterRegions(one._listPrev.get(), one._listPrevCount, one._listSegments.get(), full, 1, true, 0, split * 8);
+        double top = us_since(start) / N;
+        start = Clock::now();
+        for (int f = 0; f < N; f++) one._rasterRegions(one._listPrev.get(), one._listPrevCount, one._listSegments.get(), full, 1, true, split * 8, 64);
+        double bottom = us_since(start) / N;
+        double two_cores = (top > bottom) ? top : bottom;
+
+        bool same = !memcmp(one._buffer.get(), two._buffer.get(), 1024);
+        printf("%-22s split %u | 1 core %7.1f us | top %6.1f bottom %6.1f -> 2 cores est %6.1f us (x%.2f) | 2 threads %7.1f us | %s\n",
+               names[kind], split, single, top, bottom, two_cores, single / two_cores, threads, same ? "same" : "DIFF");
+        two.rasterCores(1);
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+// Поворот холста (canvasRotation) на ПК: сверка транспонирования блоками 8x8 (SWAR) с попиксельным
+// поворотом и замер времени подготовки кадра для дисплея.
+//
+//   sh extras/host/build.sh extras/bench/rotation.cpp && /tmp/savaoled_host/rotation
+#include <chrono>
+#include <random>
+#include <vector>
+#define private public // Доступ к _buffer и _panelFrame() для сверки
+#include "SavaOLED_ESP32.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Попиксельный поворот логического кадра width x height в кадр дисплея шириной panel_width
+static void rotate_per_pixel(const uint8_t* src, uint8_t* dst, int width, int height, int turn, int panel_width) {
+    memset(dst, 0, width * height / 8);
+    for (int x = 0; x < width; x++) {
+        for (int y = 0; y < height; y++) {
+            if (!((src[x + (y / 8) * width] >> (y % 8)) & 1)) continue;
+            int px = (turn == ROT_90) ? y : height - 1 - y;
+            int py = (turn == ROT_90) ? width - 1 - x : x;
+            dst[px + (py / 8) * panel_width] |= 1 << (py % 8);
+        }
+    }
+}
+
+int main() {
+    // Сверка: случайные кадры, оба поворота, дисплеи 128x64 и 128x32
+    int bad = 0;
+    for (int panel_height : { 64, 32 }) {
+        for (int turn : { ROT_90, ROT_270 }) {
+            SavaOLED_ESP32 oled(128, panel_height);
+            oled.canvasRotation(turn);
+            if (oled.getWidth() != panel_height || oled.getHeight() != 128) bad++;
+            std::mt19937 rng(1);
+            std::vector<uint8_t> expected(oled._bufferSize);
+            for (int k = 0; k < 200; k++) {
+                for (int i = 0; i < oled._bufferSize; i++) oled._buffer[i] = rng();
+                rotate_per_pixel(oled._buffer.get(), expected.data(), oled._width, oled._height, turn, 128);
+                bad += memcmp(oled._panelFrame(), expected.data(), oled._bufferSize) != 0;
+            }
+        }
+    }
+    printf("rotation mismatches: %d\n", bad);
+
+    // Замер: кадр 64x128 (портрет на дисплее 128x64), один байт меняется между кадрами
+    SavaOLED_ESP32 oled(128, 64);
+    oled.canvasRotation(ROT_90);
+    for (int i = 0; i < 1024; i++) oled._buffer[i] = i * 37;
+    std::vector<uint8_t> rotated(1024);
+    uint32_t checksum = 0; // Чтобы компилятор не выбросил поворот
+    const int N = 20000;
+
+    auto start = Clock::now();
+    for (int k = 0; k < N; k++) {
+        oled._buffer[k & 1023] ^= 1;
+        checksum += oled._panelFrame()[k & 1023];
+    }
+    double swar = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / N;
+
+    start = Clock::now();
+    for (int k = 0; k < N / 20; k++) {
+        oled._buffer[k & 1023] ^= 1;
+        rotate_per_pixel(oled._buffer.get(), rotated.data(), 64, 128, ROT_90, 128);
+        checksum += rotated[k & 1023];
+    }
+    double per_pixel = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / (N / 20);
+
+    printf("128x64 ROT_90: SWAR 8x8 %.2f us/frame, per-pixel %.2f us/frame (x%.1f) [%u]\n", swar, per_pixel, per_pixel / swar,
+           (unsigned)checksum);
+    return bad ? 1 : 0;
+}
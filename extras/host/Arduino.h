@@ -0,0 +1,44 @@
+#pragma once
+// Заглушка Arduino.h для сборки библиотеки на ПК (см. build.sh)
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <algorithm>
+
+#define PROGMEM
+#define memcpy_P memcpy
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+using std::min;
+using std::max;
+
+typedef int esp_err_t;
+#define ESP_OK 0
+inline const char* esp_err_to_name(esp_err_t) { return "ESP_ERR"; }
+
+unsigned long millis();     // Время задаётся тестом через g_millis
+unsigned long micros();     // Настоящее время (steady_clock)
+void delay(unsigned long ms);
+extern unsigned long g_millis;
+
+// Serial печатает в stdout
+struct HostSerial {
+    void begin(unsigned long) {}
+    template <class... Args> void printf(const char* format, Args... args) { ::printf(format, args...); }
+    void print(const char* text) { fputs(text, stdout); }
+    void println(const char* text) { puts(text); }
+};
+extern HostSerial Serial;
+
+class String {
+    std::string _text;
+public:
+    String(const char* text = "") : _text(text) {}
+    const char* c_str() const { return _text.c_str(); }
+};
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
@@ -0,0 +1,28 @@
+#!/bin/sh
+# Сборка проверок и замеров библиотеки на ПК (Linux, g++) с заглушками Arduino, I2C и FreeRTOS.
+# Задачи FreeRTOS - потоки std::thread, передачи I2C - в g_i2c_hook (эмулятор ssd1306_panel.h).
+#
+# Использование (из любого каталога):
+#   sh extras/host/build.sh extras/host/render_task_torn.cpp            # -> /tmp/savaoled_host/render_task_torn
+#   OPT="-O1 -g" sh extras/host/build.sh extras/host/render_task_torn.cpp -fsanitize=thread
+# Переменные: OUT - каталог сборки, OPT - оптимизация (по умолчанию -O2).
+set -e
+HOST=$(cd "$(dirname "$0")" && pwd)
+ROOT=$(cd "$HOST/../.." && pwd)
+MAIN=$1
+shift
+OUT=${OUT:-/tmp/savaoled_host}
+NAME=$(basename "$MAIN" .cpp)
+
+# Копия src: на xtensa int32_t - это long, на ПК - int, и перегрузка print(int) совпала бы с print(int32_t)
+rm -rf "$OUT/src"
+mkdir -p "$OUT"
+cp -r "$ROOT/src" "$OUT/src"
+sed -i '/void print(int value, uint8_t min_digits = 0);/d' "$OUT/src/SavaOLED_ESP32.h"
+sed -i '/^void SavaOLED_ESP32::print(int value, uint8_t min_digits)/d' "$OUT/src/SavaOLED_ESP32.cpp"
+
+# Заглушки FreeRTOS подключаются первыми: проверки с "#define private public" не должны задеть <thread>
+g++ -std=gnu++2b ${OPT:--O2} -Wall -Wextra -I"$HOST" -I"$OUT/src" "$@" \
+    -include "$HOST/freertos/task.h" -include "$HOST/freertos/semphr.h" \
+    "$MAIN" "$OUT/src/SavaOLED_ESP32.cpp" "$HOST/host_stubs.cpp" -o "$OUT/$NAME" -lpthread
+echo "$OUT/$NAME"
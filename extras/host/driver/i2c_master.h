@@ -0,0 +1,33 @@
+#pragma once
+// Заглушка драйвера I2C ESP-IDF: все передачи уходят в g_i2c_hook (например, эмулятор ssd1306_panel.h)
+#include <cstddef>
+#include <cstdint>
+
+typedef int i2c_port_t;
+enum { I2C_NUM_0, I2C_NUM_1 };
+typedef int gpio_num_t;
+typedef void* i2c_master_bus_handle_t;
+typedef void* i2c_master_dev_handle_t;
+enum { I2C_CLK_SRC_DEFAULT, I2C_ADDR_BIT_LEN_7 };
+
+struct i2c_master_bus_config_t {
+    int i2c_port;
+    gpio_num_t sda_io_num, scl_io_num;
+    int clk_source;
+    int glitch_ignore_cnt;
+    struct { unsigned enable_internal_pullup : 1; } flags;
+};
+struct i2c_device_config_t {
+    int dev_addr_length;
+    uint16_t device_address;
+    uint32_t scl_speed_hz;
+};
+
+int i2c_new_master_bus(const i2c_master_bus_config_t* config, i2c_master_bus_handle_t* bus);
+int i2c_master_bus_add_device(i2c_master_bus_handle_t bus, const i2c_device_config_t* config, i2c_master_dev_handle_t* dev);
+int i2c_master_bus_rm_device(i2c_master_dev_handle_t dev);
+int i2c_del_master_bus(i2c_master_bus_handle_t bus);
+int i2c_master_transmit(i2c_master_dev_handle_t dev, const uint8_t* data, size_t size, int timeout_ms);
+
+// Перехват передач: data[0] = 0x00 - команды, 0x40 - данные GDDRAM
+extern int (*g_i2c_hook)(const uint8_t* data, size_t size);
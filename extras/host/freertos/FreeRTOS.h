@@ -0,0 +1,32 @@
+#pragma once
+// Заглушки FreeRTOS на std::thread: задача = поток, уведомление и семафор = mutex + condition_variable
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) (ms)
+
+struct HostTask {
+    std::mutex lock;
+    std::condition_variable wake;
+    uint32_t notify = 0;
+};
+typedef HostTask* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+struct HostSemaphore {
+    std::mutex lock;
+    std::condition_variable wake;
+    int count = 0;
+};
+typedef HostSemaphore* SemaphoreHandle_t;
@@ -0,0 +1,24 @@
+#pragma once
+#include "FreeRTOS.h"
+
+// Мьютекс и двоичный семафор: счётчик 0/1, ожидание без тайм-аута
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+    SemaphoreHandle_t semaphore = new HostSemaphore;
+    semaphore->count = 1;
+    return semaphore;
+}
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return new HostSemaphore; }
+inline void vSemaphoreDelete(SemaphoreHandle_t semaphore) { delete semaphore; }
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t) {
+    std::unique_lock<std::mutex> guard(semaphore->lock);
+    semaphore->wake.wait(guard, [semaphore] { return semaphore->count > 0; });
+    semaphore->count--;
+    return pdTRUE;
+}
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    std::lock_guard<std::mutex> guard(semaphore->lock);
+    semaphore->count = 1;
+    semaphore->wake.notify_one();
+    return pdTRUE;
+}
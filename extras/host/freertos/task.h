@@ -0,0 +1,49 @@
+#pragma once
+#include "FreeRTOS.h"
+#include <pthread.h>
+
+// Задача текущего потока (для ulTaskNotifyTake и vTaskDelete(NULL))
+inline thread_local HostTask* g_host_task = nullptr;
+
+// Ядро и приоритет на ПК не учитываются: задача - отсоединённый поток
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char*, uint32_t, void* arg,
+                                          UBaseType_t, TaskHandle_t* handle, BaseType_t) {
+    HostTask* task = new HostTask;
+    if (handle) *handle = task;
+    std::thread([function, arg, task] {
+        g_host_task = task;
+        function(arg);
+    }).detach();
+    return pdPASS;
+}
+
+inline void vTaskDelete(TaskHandle_t task) {
+    if (task) return; // Удаление чужой задачи библиотекой не используется
+    delete g_host_task;
+    g_host_task = nullptr;
+    pthread_exit(nullptr);
+}
+
+inline void vTaskDelay(TickType_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+inline void xTaskNotifyGive(TaskHandle_t task) {
+    std::lock_guard<std::mutex> guard(task->lock);
+    task->notify++;
+    task->wake.notify_one();
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t) {
+    HostTask* task = g_host_task;
+    std::unique_lock<std::mutex> guard(task->lock);
+    task->wake.wait(guard, [task] { return task->notify > 0; });
+    uint32_t value = task->notify;
+    task->notify = clear ? 0 : value - 1;
+    return value;
+}
+
+inline bool xPortInIsrContext() { return false; }
+inline void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken) {
+    xTaskNotifyGive(task);
+    if (woken) *woken = pdTRUE;
+}
+#define portYIELD_FROM_ISR(...) do {} while (0)
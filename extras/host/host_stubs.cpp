@@ -0,0 +1,24 @@
+// Реализация заглушек Arduino и I2C для сборки на ПК
+#include <chrono>
+#include "Arduino.h"
+#include "driver/i2c_master.h"
+
+HostSerial Serial;
+
+unsigned long g_millis = 0;
+unsigned long millis() { return g_millis; }
+unsigned long micros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+void delay(unsigned long) {}
+
+int (*g_i2c_hook)(const uint8_t* data, size_t size) = nullptr;
+
+int i2c_new_master_bus(const i2c_master_bus_config_t*, i2c_master_bus_handle_t* bus) { *bus = (void*)1; return ESP_OK; }
+int i2c_master_bus_add_device(i2c_master_bus_handle_t, const i2c_device_config_t*, i2c_master_dev_handle_t* dev) { *dev = (void*)1; return ESP_OK; }
+int i2c_master_bus_rm_device(i2c_master_dev_handle_t) { return ESP_OK; }
+int i2c_del_master_bus(i2c_master_bus_handle_t) { return ESP_OK; }
+int i2c_master_transmit(i2c_master_dev_handle_t, const uint8_t* data, size_t size, int) {
+    return g_i2c_hook ? g_i2c_hook(data, size) : ESP_OK;
+}
@@ -0,0 +1,99 @@
+// Постраничный режим (pageMode) на ПК: случайные сцены записываются в список отображения и выводятся
+// полосами в эмулятор SSD1306. Содержимое эмулятора после каждого кадра сверяется с той же сценой,
+// нарисованной в обычный кадровый буфер. Затем - строки длиннее экрана (буфер строки в pageMode шириной с экран
+// и хранит только видимое окно строки).
+//
+//   sh extras/host/build.sh extras/host/page_mode_check.cpp && /tmp/savaoled_host/page_mode_check [страниц в полосе]
+#define private public // Доступ к _lineBufferWidth для отчёта
+#include "random_scene.h"
+#include "ssd1306_panel.h"
+
+// Строки длиннее экрана: выравнивание вправо и по центру, x < 0, масштаб, сжатый шрифт, смена режима
+static void long_lines(SavaOLED_ESP32 &oled, int shift) {
+    const char* text = "Очень длинная строка, которая не помещается на экран целиком 0123456789 ABCDEFGHIJ";
+    oled.clear();
+    oled.font(SF_Font_P8);
+    oled.cursor(0, 1, StrRight);
+    oled.print(text);
+    oled.drawPrint();
+    oled.font(SF_Font_x2_P16);
+    oled.cursor(-200 + shift, 12);
+    oled.print(text);
+    oled.drawPrint();
+    oled.font(SF_Font_P8);
+    oled.textScale(2);
+    oled.cursor(10, 31, StrCenter, 100);
+    oled.print(text);
+    oled.drawPrint();
+    oled.textScale(1);
+    oled.font(SF_7Seg_Temper_NM10x14_RLE);
+    oled.cursor(-7, 48, StrRight, 60);
+    oled.print("-123.45678901234");
+    oled.drawPrint();
+    oled.font(SF_Font_P8);
+    oled.drawMode(INV_AUTO);
+    oled.cursor(70, 52);
+    oled.print(text);
+    oled.drawPrint();
+    oled.drawMode(REPLACE);
+}
+
+// Кадр постраничного экземпляра уже в эмуляторе: эталон отправляется туда же, затем экран возвращается
+static bool matches_reference(SavaOLED_ESP32 &reference) {
+    uint8_t shown[8][128];
+    memcpy(shown, g_panel.ram, sizeof(shown));
+    long sent = g_panel.bytes;
+    reference.display();
+    bool same = !memcmp(shown, g_panel.ram, sizeof(shown));
+    memcpy(g_panel.ram, shown, sizeof(shown));
+    g_panel.bytes = sent;
+    return same;
+}
+
+int main(int argc, char** argv) {
+    int strip = (argc > 1) ? atoi(argv[1]) : 1;
+    g_i2c_hook = panel_transmit;
+
+    SavaOLED_ESP32 paged(128, 64, I2C_NUM_0, strip), reference; // Полоса - до выделения буферов
+    paged.init(400000, 5, 4);
+    reference.init(400000, 5, 4);
+    paged.displayList(40, 1024); // Длинные строки - около 600 байт текста
+    printf("strip %d: buffers %u bytes (full mode %u)\n", strip, paged.getBufferBytes(), reference.getBufferBytes());
+
+    long frames = 0, bad = 0, bytes0 = g_panel.bytes;
+    for (int s = 0; s < 300; s++) {
+        std::vector<SceneCommand> scene = scene_new(30);
+        for (int f = 0; f < 20; f++) {
+            scene_mutate(scene, 36);
+            paged.listBegin();
+            paged.clear();
+            for (auto &c : scene) scene_draw(paged, c);
+            paged.listEnd();
+            if (f == 10) paged.display(); // Полная переотправка из списка
+
+            reference.clear();
+            for (auto &c : scene) scene_draw(reference, c);
+            frames++;
+            if (!matches_reference(reference)) {
+                if (bad < 5) printf("mismatch scene %d frame %d\n", s, f);
+                bad++;
+            }
+        }
+    }
+    printf("frames %ld bad %ld, %.1f bytes sent/frame\n", frames, bad, (double)(g_panel.bytes - bytes0) / frames);
+
+    long line_bad = 0;
+    for (int shift = 0; shift < 120; shift += 3) {
+        paged.listBegin();
+        long_lines(paged, shift);
+        paged.listEnd();
+        long_lines(reference, shift);
+        if (!matches_reference(reference)) {
+            if (line_bad < 5) printf("long lines mismatch shift %d\n", shift);
+            line_bad++;
+        }
+    }
+    printf("long lines bad %ld, line buffer %u columns, buffers %u bytes\n", line_bad, paged._lineBufferWidth,
+           (unsigned)paged.getBufferBytes());
+    return (bad || line_bad) ? 1 : 0;
+}
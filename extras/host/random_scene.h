@@ -0,0 +1,103 @@
+#pragma once
+// Случайные сцены для проверок на ПК: набор команд рисования (все примитивы, режимы, шрифты, масштаб,
+// выравнивание), который можно нарисовать в любой экземпляр и сравнить результат.
+#include <random>
+#include <vector>
+#include "SavaOLED_ESP32.h"
+#include "Fonts/SF_Font_P8.h"
+#include "Fonts/SF_Font_x2_P16.h"
+#include "Fonts/SF_7Seg_Temper_NM10x14_RLE.h"
+
+struct SceneCommand {
+    int type, mode, fill;
+    int p[6];
+    int font, align, x2, scale;
+    char text[24];
+};
+
+inline std::mt19937 g_sceneRng(1);
+inline uint8_t g_sceneBitmap[16 * 3];
+// RLE: 16 + 6 + 22 = 44 байта, больше bitmap 11x20 - проверяет обрезку потока
+inline const uint8_t g_sceneRle[] = { 0x80 + 14, 0xAA, 0x05, 1, 2, 3, 4, 5, 6, 0x80 + 20, 0x0F };
+inline const savaFont* g_sceneFonts[] = { &SF_Font_P8, &SF_Font_x2_P16, &SF_7Seg_Temper_NM10x14_RLE };
+
+inline int scene_random(int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(g_sceneRng); }
+
+inline void scene_random_command(SceneCommand &c) {
+    static const int modes[] = { REPLACE, ADD_UP, INV_AUTO, ERASE, ERASE_BORDER };
+    static const char* words[] = { "Меню", "Пункт 1", "-12.5", "Hello", "OK", "12:34", "" };
+    c.type = scene_random(0, 9);
+    c.mode = modes[scene_random(0, 4)];
+    c.fill = scene_random(0, 1);
+    for (int i = 0; i < 6; i++) c.p[i] = scene_random(-20, 140);
+    c.p[1] = scene_random(-10, 70);
+    c.p[3] = scene_random(-10, 70);
+    c.p[5] = scene_random(-10, 70);
+    c.font = scene_random(0, 2);
+    c.align = scene_random(0, 2);
+    c.x2 = scene_random(0, 3) ? -1 : scene_random(10, 120);
+    c.scale = scene_random(1, 2);
+    snprintf(c.text, sizeof(c.text), "%s%d", words[scene_random(0, 6)], scene_random(0, 99));
+    if (c.type == 8 && c.mode > INV_AUTO) c.mode = REPLACE; // Текст рисуется в REPLACE / ADD_UP / INV_AUTO
+}
+
+inline void scene_draw(SavaOLED_ESP32 &oled, const SceneCommand &c) {
+    const int* p = c.p;
+    int bitmap_mode = (c.mode == ERASE || c.mode == ERASE_BORDER) ? REPLACE : c.mode;
+    switch (c.type) {
+        case 0: oled.dot(p[0], p[1], c.mode); break;
+        case 1: oled.line(p[0], p[1], p[2], p[3], c.mode); break;
+        case 2: oled.rect(p[0], p[1], p[2] % 50, p[3] % 40, c.mode, c.fill); break;
+        case 3: oled.rectR(p[0], p[1], p[2] % 50, p[3] % 40, p[4] % 8, c.mode, c.fill); break;
+        case 4: oled.circle(p[0], p[1], p[2] % 20, c.mode, c.fill); break;
+        case 5: oled.drawPeak(p[0], p[1], p[2], p[3], p[4], p[5], c.mode); break;
+        case 6: oled.drawBitmap(p[0], p[1], g_sceneBitmap, 16, 20, bitmap_mode); break;
+        case 7: oled.drawBitmapRLE(p[0], p[1], g_sceneRle, 11, 20, bitmap_mode); break;
+        case 8:
+            oled.cursor(p[0] % 128, p[1], c.align, c.x2);
+            oled.font(*g_sceneFonts[c.font]);
+            oled.textScale(c.scale);
+            oled.drawMode(c.mode);
+            oled.print(c.text);
+            oled.drawMode(REPLACE);
+            oled.textScale(1);
+            oled.font(SF_Font_P8);
+            oled.print(p[2]);
+            oled.drawPrint();
+            break;
+        case 9:
+            oled.hLine(p[0], p[1], p[2] % 60, c.mode);
+            oled.vLine(p[2], p[3], p[4] % 40, c.mode);
+            break;
+    }
+}
+
+// Случайная правка сцены между кадрами: новая команда, сдвиг, пиксель bitmap, вставка или удаление
+inline void scene_mutate(std::vector<SceneCommand> &scene, size_t max_commands) {
+    int edits = scene_random(0, 3);
+    for (int j = 0; j < edits; j++) {
+        int kind = scene_random(0, 9);
+        SceneCommand &c = scene[scene_random(0, scene.size() - 1)];
+        if (kind < 5) {
+            scene_random_command(c);
+        } else if (kind < 7) {
+            c.p[0] += scene_random(-3, 3);
+        } else if (kind < 8) {
+            g_sceneBitmap[scene_random(0, sizeof(g_sceneBitmap) - 1)] ^= 1 << scene_random(0, 7);
+        } else if (kind < 9 && scene.size() < max_commands) {
+            SceneCommand added;
+            scene_random_command(added);
+            scene.insert(scene.begin() + scene_random(0, scene.size()), added);
+        } else if (scene.size() > 1) {
+            scene.erase(scene.begin() + scene_random(0, scene.size() - 1));
+        }
+    }
+}
+
+// Новая сцена из 1..max_commands случайных команд и случайного bitmap
+inline std::vector<SceneCommand> scene_new(int max_commands) {
+    std::vector<SceneCommand> scene(scene_random(1, max_commands));
+    for (auto &c : scene) scene_random_command(c);
+    for (auto &b : g_sceneBitmap) b = scene_random(0, 255);
+    return scene;
+}
@@ -0,0 +1,46 @@
+// Растеризация на двух ядрах (rasterCores) на ПК: второе ядро - поток std::thread.
+// Случайные сцены из списка отображения рисуются двумя полосами и сверяются с той же сценой,
+// нарисованной напрямую в одном потоке.
+//
+//   sh extras/host/build.sh extras/host/raster_cores_check.cpp && /tmp/savaoled_host/raster_cores_check
+//   OPT="-O1 -g" sh extras/host/build.sh extras/host/raster_cores_check.cpp -fsanitize=thread
+#define private public // Доступ к _buffer для сверки
+#include "random_scene.h"
+
+int main() {
+    SavaOLED_ESP32 split, reference;
+    split.displayList(40, 400);
+    split.glyphCache(2048);
+    if (!split.rasterCores(2)) {
+        puts("rasterCores failed");
+        return 1;
+    }
+
+    long frames = 0, bad = 0, splits = 0, redrawn = 0, items = 0;
+    for (int s = 0; s < 400; s++) {
+        std::vector<SceneCommand> scene = scene_new(30);
+        split.listInvalidate();
+        for (int f = 0; f < 25; f++) {
+            scene_mutate(scene, 36);
+            split.listBegin();
+            split.clear();
+            for (auto &c : scene) scene_draw(split, c);
+            split.listEnd();
+
+            reference.clear();
+            for (auto &c : scene) scene_draw(reference, c);
+            frames++;
+            splits += split.getRasterSplit() != 0;
+            redrawn += split.getListRedrawn();
+            items += scene.size();
+            if (memcmp(split._buffer.get(), reference._buffer.get(), split._bufferSize)) {
+                if (bad < 5) printf("mismatch scene %d frame %d\n", s, f);
+                bad++;
+            }
+        }
+    }
+    split.rasterCores(1);
+    printf("frames %ld split %ld bad %ld, redrawn %.2f of %.2f items/frame\n", frames, splits, bad,
+           (double)redrawn / frames, (double)items / frames);
+    return bad ? 1 : 0;
+}
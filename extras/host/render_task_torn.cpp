@@ -0,0 +1,110 @@
+// Потокобезопасный режим (renderTask) на ПК: три задачи-производителя рисуют каждая свою полосу экрана
+// порциями frameBegin/frameEnd, задача рендера отправляет кадры в эмулятор SSD1306.
+// В каждой порции две линии одной длины (строки y и y+12) разделены текстом и паузой: если кадр
+// ушёл на дисплей посреди порции, длины различаются - кадр "рваный".
+//
+//   sh extras/host/build.sh extras/host/render_task_torn.cpp && /tmp/savaoled_host/render_task_torn [порций] [slow]
+//   OPT="-O1 -g" sh extras/host/build.sh extras/host/render_task_torn.cpp -fsanitize=thread
+// slow - передача с задержкой I2C 400 кГц (~22 мкс на байт), кадры перекрываются с рисованием.
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "SavaOLED_ESP32.h"
+#include "Fonts/SF_Font_P8.h"
+#include "ssd1306_panel.h"
+
+#define BAND_HEIGHT 21      // Полоса производителя r: строки r * 21 .. r * 21 + 20
+#define PRODUCERS 3
+
+static bool g_slow = false;
+static std::atomic<bool> g_pause{false};
+static long g_frameBytes = 0, g_framesSeen = 0, g_torn = 0;
+
+// Длина линии от x = 0 в строке y по содержимому эмулятора
+static int bar_length(int y) {
+    int length = 0;
+    while (length < 128 && ((g_panel.ram[y / 8][length] >> (y % 8)) & 1)) length++;
+    return length;
+}
+
+// Передача I2C: после каждого полного кадра линии каждой полосы сверяются
+static int checked_transmit(const uint8_t* data, size_t size) {
+    panel_transmit(data, size);
+    if (data[0] == 0x00) {
+        g_frameBytes = 0;
+        return 0;
+    }
+    if (g_slow) std::this_thread::sleep_for(std::chrono::microseconds(22 * (size + 1)));
+    g_frameBytes += size - 1;
+    if (g_frameBytes == 1024) {
+        g_framesSeen++;
+        for (int r = 0; r < PRODUCERS; r++) {
+            int y = r * BAND_HEIGHT;
+            if (bar_length(y) != bar_length(y + 12)) g_torn++;
+        }
+    }
+    return 0;
+}
+
+// Порция производителя r со значением value
+static void draw_band(SavaOLED_ESP32 &oled, int r, int value) {
+    int y = r * BAND_HEIGHT;
+    oled.rect(0, y, 128, BAND_HEIGHT, ERASE, FILL);
+    oled.rect(0, y, 1 + value % 100, 1, REPLACE, FILL);
+    oled.font(SF_Font_P8);
+    oled.cursor(0, y + 2);
+    oled.print("v=");
+    oled.print(value);
+    oled.drawPrint();
+    if (g_pause) std::this_thread::sleep_for(std::chrono::microseconds(30)); // Задача занята посреди порции
+    oled.rect(0, y + 12, 1 + value % 100, 1, REPLACE, FILL);
+}
+
+int main(int argc, char** argv) {
+    int batches = (argc > 1) ? atoi(argv[1]) : 2000;
+    g_slow = (argc > 2);
+    g_i2c_hook = checked_transmit;
+
+    SavaOLED_ESP32 oled(128, 64);
+    oled.init(400000, 5, 4);
+    oled.displayList(24, 256);
+    if (!oled.renderTask(1)) {
+        puts("renderTask failed");
+        return 1;
+    }
+
+    int last[PRODUCERS];
+    std::vector<std::thread> producers;
+    g_pause = true;
+    for (int r = 0; r < PRODUCERS; r++) {
+        producers.emplace_back([&, r] {
+            for (int i = 0; i < batches; i++) {
+                int value = i * 7 + r * 13;
+                oled.frameBegin();
+                draw_band(oled, r, value);
+                oled.frameEnd();
+                last[r] = value;
+                if (g_slow) std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+        });
+    }
+    for (auto &producer : producers) producer.join();
+    g_pause = false;
+    oled.renderStop();
+
+    // Итоговый экран должен совпасть с последними порциями всех задач, нарисованными без задачи рендера
+    uint8_t shown[8][128];
+    memcpy(shown, g_panel.ram, sizeof(shown));
+    long frames = g_framesSeen;
+    g_i2c_hook = panel_transmit;
+    SavaOLED_ESP32 reference(128, 64);
+    reference.init(400000, 5, 4);
+    for (int r = 0; r < PRODUCERS; r++) draw_band(reference, r, last[r]);
+    reference.display();
+    bool same = memcmp(shown, g_panel.ram, sizeof(shown)) == 0;
+
+    printf("frames sent %u seen %ld torn %ld dropped %u final %s\n", oled.getRenderFrames(), frames, g_torn,
+           oled.getRenderDropped(), same ? "ok" : "MISMATCH");
+    return (g_torn || !same) ? 1 : 0;
+}
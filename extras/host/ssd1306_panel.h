@@ -0,0 +1,47 @@
+#pragma once
+// Эмулятор GDDRAM SSD1306 (горизонтальная адресация): разбирает команды 0x21/0x22 и пишет данные в ram.
+// Подключение: g_i2c_hook = panel_transmit;
+#include <cstring>
+#include "driver/i2c_master.h"
+
+struct HostPanel {
+    uint8_t ram[8][128];
+    int col0 = 0, col1 = 127, page0 = 0, page1 = 7;
+    int col = 0, page = 0;
+    long bytes = 0;     // Байт данных GDDRAM принято
+    long packets = 0;   // Передач I2C
+};
+inline HostPanel g_panel;
+
+inline int panel_transmit(const uint8_t* data, size_t size) {
+    HostPanel &panel = g_panel;
+    panel.packets++;
+    if (data[0] == 0x00) {
+        for (size_t i = 1; i < size;) {
+            uint8_t command = data[i++];
+            if (command == 0x21 && i + 1 < size) {
+                panel.col0 = data[i];
+                panel.col1 = data[i + 1];
+                panel.col = panel.col0;
+                i += 2;
+            } else if (command == 0x22 && i + 1 < size) {
+                panel.page0 = data[i];
+                panel.page1 = data[i + 1];
+                panel.page = panel.page0;
+                i += 2;
+            } else {
+                break; // Прочие команды (инициализация) на содержимое не влияют
+            }
+        }
+        return 0;
+    }
+    for (size_t i = 1; i < size; i++) {
+        panel.bytes++;
+        panel.ram[panel.page][panel.col] = data[i];
+        if (++panel.col > panel.col1) {
+            panel.col = panel.col0;
+            if (++panel.page > panel.page1) panel.page = panel.page0;
+        }
+    }
+    return 0;
+}
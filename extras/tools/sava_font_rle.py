@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Конвертер шрифтов SavaOLED_ESP32 в сжатый формат RLE.
+
+Читает заголовок шрифта из src/Fonts (SF_*.h), сжимает данные каждого символа
+и пишет новый заголовок с тем же набором таблиц (Offsets, Data, VMetrics, Ranges).
+
+Формат сжатого символа: [ширина | 0x80] [поток токенов]
+  токен 0x00..0x7F - литерал: следующие (токен + 1) байт копируются как есть;
+  токен 0x80..0xBF - повтор: следующий байт повторяется (токен - 0x80 + 2) раз;
+  токен 0xC0..0xFF - парные колонки: следующие (токен - 0xC0 + 1) байт выводятся
+                     каждый дважды (колонка равна предыдущей - типично для шрифтов x2).
+Поток разворачивается в тот же порядок, что и несжатый символ:
+[страница 0: колонки 0..w-1] [страница 1: колонки 0..w-1] ...
+Если сжатие не даёт выигрыша, символ остаётся несжатым (быстрый путь в drawPrint).
+
+Картинки для drawBitmapRLE() сжимаются целиком одним потоком (ключ --bitmap <имя массива>).
+
+Использование:
+  python3 sava_font_rle.py ../../src/Fonts/SF_Font_x2_P16.h -o ../../src/Fonts/SF_Font_x2_P16_RLE.h
+  python3 sava_font_rle.py SF_7Seg_Temper_NM10x14.h --stats
+  python3 sava_font_rle.py logo.h --bitmap logo_128x64 -o logo_rle.h
+"""
+
+import argparse
+import os
+import re
+import sys
+
+RLE_FLAG = 0x80
+MAX_LITERAL = 128
+MAX_REPEAT = 65
+MAX_PAIRS = 64
+
+
+def rle_encode(data):
+    """Оптимальное (минимальное по размеру) RLE-кодирование потока байт."""
+    n = len(data)
+    cost = [0] * (n + 1)
+    choice = [None] * (n + 1)
+    for i in range(n - 1, -1, -1):
+        best, best_choice = None, None
+        # повтор
+        run = 1
+        while i + run < n and run < MAX_REPEAT and data[i + run] == data[i]:
+            run += 1
+        for k in range(2, run + 1):
+            c = 2 + cost[i + k]
+            if best is None or c < best:
+                best, best_choice = c, ('rep', k)
+        # литерал
+        for k in range(1, min(MAX_LITERAL, n - i) + 1):
+            c = 1 + k + cost[i + k]
+            if best is None or c < best:
+                best, best_choice = c, ('lit', k)
+        # парные колонки
+        k = 0
+        while k < MAX_PAIRS and i + 2 * k + 1 < n and data[i + 2 * k] == data[i + 2 * k + 1]:
+            k += 1
+            c = 1 + k + cost[i + 2 * k]
+            if c < best:
+                best, best_choice = c, ('pair', k)
+        cost[i], choice[i] = best, best_choice
+    out = []
+    i = 0
+    while i < n:
+        kind, k = choice[i]
+        if kind == 'rep':
+            out += [0x80 + k - 2, data[i]]
+            i += k
+        elif kind == 'pair':
+            out += [0xC0 + k - 1] + list(data[i:i + 2 * k:2])
+            i += 2 * k
+        else:
+            out += [k - 1] + list(data[i:i + k])
+            i += k
+    return out
+
+
+def rle_decode(stream, size):
+    out = []
+    i = 0
+    while len(out) < size:
+        token = stream[i]
+        if token >= 0xC0:
+            count = (token & 0x3F) + 1
+            for b in stream[i + 1:i + 1 + count]:
+                out += [b, b]
+            i += count + 1
+        elif token >= 0x80:
+            out += [stream[i + 1]] * ((token & 0x3F) + 2)
+            i += 2
+        else:
+            out += stream[i + 1:i + 2 + token]
+            i += token + 2
+    return out[:size], i
+
+
+def parse_array(text, name, ctype):
+    m = re.search(r'const\s+%s\s+%s\[\]\s*=\s*\{(.*?)\};' % (ctype, re.escape(name)), text, re.S)
+    if not m:
+        return None
+    return m
+
+
+def parse_font(text):
+    m = re.search(r'const\s+savaFont\s+(\w+)\s*=\s*\{(.*?)\};', text, re.S)
+    if not m:
+        sys.exit('Не найдено описание savaFont')
+    name = m.group(1)
+    fields = [re.sub(r'//.*', '', line).strip().rstrip(',') for line in m.group(2).split('\n')]
+    fields = [f for f in fields if f]
+    height = int(fields[2], 0)
+    data_m = parse_array(text, name + '_Data', 'uint8_t')
+    offs_m = parse_array(text, name + '_Offsets', 'uint16_t')
+    if not data_m or not offs_m:
+        sys.exit('Не найдены массивы %s_Data / %s_Offsets' % (name, name))
+    offsets = [int(v, 0) for v in re.sub(r'//.*', '', offs_m.group(1)).replace('\n', ' ').split(',') if v.strip()]
+    data = [int(v, 0) for v in re.sub(r'//.*', '', data_m.group(1)).replace('\n', ' ').split(',') if v.strip()]
+    comments = re.findall(r'//\s*(.*)', data_m.group(1))
+    glyphs = []
+    for idx, start in enumerate(offsets):
+        end = offsets[idx + 1] if idx + 1 < len(offsets) else len(data)
+        glyphs.append(data[start:end])
+    if len(comments) != len(glyphs):
+        comments = ['idx %d' % i for i in range(len(glyphs))]
+    return name, height, glyphs, comments, (offs_m, data_m)
+
+
+def convert_bitmap(text, name, output):
+    m = re.search(r'const\s+uint8_t\s+%s\[\]\s*(?:PROGMEM\s*)?=\s*\{(.*?)\};' % re.escape(name), text, re.S)
+    if not m:
+        sys.exit('Не найден массив %s' % name)
+    data = [int(v, 0) for v in re.sub(r'//.*', '', m.group(1)).replace('\n', ' ').split(',') if v.strip()]
+    packed = rle_encode(data)
+    decoded, _ = rle_decode(packed, len(data))
+    assert decoded == data
+    print('%s: %d -> %d байт (%.1f%%)' % (name, len(data), len(packed), 100.0 * len(packed) / len(data)), file=sys.stderr)
+    if output is None:
+        return
+    lines = ['// Сжато sava_font_rle.py из %s (%d байт), рисовать через drawBitmapRLE()' % (name, len(data)),
+             'const uint8_t %s_RLE[] = {' % name]
+    for i in range(0, len(packed), 16):
+        lines.append('    ' + ', '.join('0x%02X' % b for b in packed[i:i + 16]) + ',')
+    lines.append('};')
+    with open(output, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines) + '\n')
+    print('Записан %s' % output, file=sys.stderr)
+
+
+def compress_glyph(glyph, pages):
+    width = glyph[0]
+    if width & RLE_FLAG:
+        sys.exit('Шрифт уже сжат')
+    pixels = glyph[1:1 + width * pages]
+    packed = rle_encode(pixels)
+    decoded, _ = rle_decode(packed, len(pixels))
+    assert decoded == pixels
+    if len(packed) >= len(pixels):
+        return glyph, False
+    return [width | RLE_FLAG] + packed, True
+
+
+def format_offsets(offsets):
+    lines = []
+    for i in range(0, len(offsets), 12):
+        lines.append('    ' + ''.join('%-3d, ' % v for v in offsets[i:i + 12]).rstrip(' ') + ' ')
+    return '\n'.join(lines)
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Сжатие шрифта SavaOLED_ESP32 в формат RLE')
+    ap.add_argument('input', help='заголовок шрифта (SF_*.h)')
+    ap.add_argument('-o', '--output', help='выходной заголовок (по умолчанию <имя>_RLE.h рядом со входным)')
+    ap.add_argument('-n', '--name', help='имя нового шрифта (по умолчанию <имя>_RLE)')
+    ap.add_argument('--stats', action='store_true', help='только вывести статистику, ничего не писать')
+    ap.add_argument('--bitmap', metavar='ARRAY', help='сжать массив-картинку ARRAY для drawBitmapRLE()')
+    args = ap.parse_args()
+
+    text = open(args.input, encoding='utf-8').read()
+    if args.bitmap:
+        convert_bitmap(text, args.bitmap, None if args.stats else (args.output or args.bitmap + '_rle.h'))
+        return
+    name, height, glyphs, comments, (offs_m, data_m) = parse_font(text)
+    pages = (height + 7) // 8
+    new_name = args.name or name + '_RLE'
+
+    packed_glyphs = []
+    packed_count = 0
+    for g in glyphs:
+        pg, packed = compress_glyph(g, pages)
+        packed_glyphs.append(pg)
+        packed_count += packed
+
+    raw_size = sum(len(g) for g in glyphs)
+    new_size = sum(len(g) for g in packed_glyphs)
+    print('%s: %d символов, данные %d -> %d байт (%.1f%%), сжато символов: %d' % (
+        name, len(glyphs), raw_size, new_size, 100.0 * new_size / raw_size, packed_count), file=sys.stderr)
+    if args.stats:
+        return
+
+    offsets = []
+    pos = 0
+    for g in packed_glyphs:
+        offsets.append(pos)
+        pos += len(g)
+    if pos > 0xFFFF:
+        sys.exit('Данные шрифта не помещаются в 16-битные смещения')
+
+    data_lines = []
+    for g, c in zip(packed_glyphs, comments):
+        data_lines.append('    ' + ', '.join('0x%02X' % b for b in g) + ', // ' + c)
+
+    out = text
+    out = out.replace(data_m.group(1), '\n' + '\n'.join(data_lines) + '\n')
+    out = out.replace(offs_m.group(1), '\n' + format_offsets(offsets) + '\n')
+    out = re.sub(r'\b%s(?=_|\b)' % re.escape(name), new_name, out)
+    out = re.sub(r'\b%s_H\b' % re.escape(name.upper()), new_name.upper() + '_H', out)
+
+    output = args.output or os.path.join(os.path.dirname(args.input), new_name + '.h')
+    with open(output, 'w', encoding='utf-8') as f:
+        f.write(out)
+    print('Записан %s (%s)' % (output, new_name), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
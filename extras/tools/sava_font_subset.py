@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Генератор подмножества шрифта SavaOLED_ESP32.
+
+Оставляет в шрифте только символы, которые реально выводит прошивка, и пишет
+новый заголовок: данные и смещения перенумерованы, таблица диапазонов Unicode
+(_Ranges) собрана из подряд идущих кодовых точек, вертикальные метрики (если есть)
+урезаны в том же порядке.
+
+Набор символов берётся из строковых литералов исходников (--scan) и/или явно (--chars).
+Символ '?' добавляется всегда: им библиотека заменяет отсутствующие символы.
+Работает и со сжатыми шрифтами (sava_font_rle.py) - данные символов копируются как есть.
+
+Использование:
+  python3 sava_font_subset.py ../../src/Fonts/SF_Font_P8.h --scan ~/Arduino/MyDash -o SF_Font_P8_Dash.h
+  python3 sava_font_subset.py SF_Font_x2_P16.h --chars "0123456789:.- Температура" --digits
+  python3 sava_font_subset.py SF_Font_P8.h --scan src --list     # показать найденные символы
+"""
+
+import argparse
+import codecs
+import os
+import re
+import sys
+
+from sava_font_rle import parse_array, parse_font, format_offsets
+
+SOURCE_EXT = ('.ino', '.cpp', '.c', '.h', '.hpp')
+STRING_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+DIGITS = '0123456789-+. '
+
+
+def scan_sources(paths):
+    chars = set()
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, names in os.walk(path):
+                files += [os.path.join(root, n) for n in names if n.endswith(SOURCE_EXT)]
+        else:
+            files.append(path)
+    for fn in files:
+        with open(fn, encoding='utf-8', errors='replace') as f:
+            for line in f:
+                if line.lstrip().startswith('#include'):
+                    continue
+                for lit in STRING_RE.findall(line):
+                    raw = codecs.escape_decode(lit.encode('utf-8'))[0]
+                    chars.update(raw.decode('utf-8', errors='ignore'))
+    return chars
+
+
+def legacy_ranges(font_index):
+    # Шрифты без таблицы _Ranges: схема по font_index (см. _getCharIndex)
+    if font_index == 0:
+        return [(ord(' '), 1, 17), (ord('*'), 1, 15), (ord('+'), 1, 13), (ord('-'), 1, 12), (ord('.'), 1, 0),
+                (ord('/'), 1, 14), (ord('0'), 10, 1), (ord(':'), 1, 11), (ord('='), 1, 16)]
+    return [(0x20, 95, 0), (0x401, 1, 159), (0x410, 64, 95), (0x451, 1, 160)]
+
+
+def parse_ranges(text, name):
+    m = parse_array(text, name + '_Ranges', 'savaRange')
+    if not m:
+        return None
+    body = re.sub(r'//.*', '', m.group(1))
+    return [tuple(int(v, 0) for v in r) for r in re.findall(r'\{\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*\}', body)]
+
+
+def char_comment(cp):
+    ch = chr(cp)
+    return "'%s'" % ch if ch.isprintable() and ch not in "'\\" else 'U+%04X' % cp
+
+
+def main():
+    ap = argparse.ArgumentParser(description='Подмножество шрифта SavaOLED_ESP32 под набор символов прошивки')
+    ap.add_argument('input', help='заголовок шрифта (SF_*.h)')
+    ap.add_argument('--scan', nargs='+', default=[], metavar='PATH', help='файлы/папки со скетчем для поиска строк')
+    ap.add_argument('--chars', default='', help='дополнительные символы')
+    ap.add_argument('--digits', action='store_true', help='добавить "%s" (числа из print())' % DIGITS)
+    ap.add_argument('-n', '--name', help='имя нового шрифта (по умолчанию <имя>_Sub)')
+    ap.add_argument('-o', '--output', help='выходной заголовок (по умолчанию <имя>.h рядом со входным)')
+    ap.add_argument('--list', action='store_true', help='только вывести набор символов и статистику')
+    args = ap.parse_args()
+
+    text = open(args.input, encoding='utf-8').read()
+    name, height, glyphs, comments, _ = parse_font(text)
+    m = re.search(r'const\s+savaFont\s+\w+\s*=\s*\{(.*?)\};', text, re.S)
+    fields = [f for f in (re.sub(r'//.*', '', line).strip().rstrip(',') for line in m.group(1).split('\n')) if f]
+    font_index = int(fields[3], 0)
+    ranges = parse_ranges(text, name) or legacy_ranges(font_index)
+    vm = parse_array(text, name + '_VMetrics', 'uint8_t')
+    vmetrics = [int(v, 0) for v in re.sub(r'//.*', '', vm.group(1)).replace('\n', ' ').split(',') if v.strip()] if vm else None
+
+    code_to_glyph = {}
+    for first, count, index in ranges:
+        for k in range(count):
+            code_to_glyph[first + k] = index + k
+
+    wanted = scan_sources(args.scan) | set(args.chars) | {'?'}
+    if args.digits:
+        wanted |= set(DIGITS)
+    codes = sorted(ord(c) for c in wanted if ord(c) in code_to_glyph)
+    missing = sorted(c for c in wanted if ord(c) not in code_to_glyph and ord(c) >= 0x20 and c != '?')
+
+    # Глифы нового шрифта в порядке кодовых точек; один глиф может обслуживать несколько кодов
+    new_index = {}
+    order = []
+    for cp in codes:
+        g = code_to_glyph[cp]
+        if g not in new_index:
+            new_index[g] = len(order)
+            order.append(g)
+
+    raw_size = sum(len(g) for g in glyphs)
+    new_size = sum(len(glyphs[g]) for g in order)
+    print('%s: символов %d -> %d, данные %d -> %d байт' % (name, len(glyphs), len(order), raw_size, new_size),
+          file=sys.stderr)
+    if missing:
+        print('Нет в шрифте (будут выведены как ?): %s' % ''.join(missing), file=sys.stderr)
+    if args.list:
+        print(''.join(chr(c) for c in codes))
+        return
+
+    # Диапазоны: подряд идущие коды с подряд идущими глифами
+    new_ranges = []
+    for cp in codes:
+        idx = new_index[code_to_glyph[cp]]
+        if new_ranges and new_ranges[-1][0] + new_ranges[-1][1] == cp and new_ranges[-1][2] + new_ranges[-1][1] == idx:
+            new_ranges[-1][1] += 1
+        else:
+            new_ranges.append([cp, 1, idx])
+    if len(new_ranges) > 255:
+        sys.exit('Слишком много диапазонов (%d > 255)' % len(new_ranges))
+
+    new_name = args.name or name + '_Sub'
+    guard = new_name.upper() + '_H'
+    offsets = []
+    pos = 0
+    for g in order:
+        offsets.append(pos)
+        pos += len(glyphs[g])
+
+    out = ['#ifndef %s' % guard, '#define %s' % guard,
+           '// Подмножество %s (%d из %d символов), создано sava_font_subset.py' % (name, len(order), len(glyphs)),
+           'const uint16_t %s_Offsets[] = {' % new_name, format_offsets(offsets), '};', '',
+           'const uint8_t %s_Data[] = {' % new_name]
+    for i, g in enumerate(order):
+        label = re.sub(r'\(idx \d+\)', '(idx %d)' % i, comments[g])
+        out.append('    ' + ', '.join('0x%02X' % b for b in glyphs[g]) + ', // ' + label)
+    out += ['};', '']
+    if vmetrics:
+        out.append('const uint8_t %s_VMetrics[] = {' % new_name)
+        for g in order:
+            out.append('    %d, %d, ' % (vmetrics[g * 2], vmetrics[g * 2 + 1]))
+        out += ['};', '']
+    out.append('const savaRange %s_Ranges[] = {' % new_name)
+    for first, count, index in new_ranges:
+        label = char_comment(first) + ('..' + char_comment(first + count - 1) if count > 1 else '')
+        out.append('    { 0x%04X, %-3d, %-3d }, // %s' % (first, count, index, label))
+    out += ['};', '',
+            'const savaFont %s = {' % new_name,
+            '    (const uint8_t*)%s_Data,' % new_name,
+            '    (const uint16_t*)%s_Offsets,' % new_name,
+            '    %d, // Height' % height,
+            '    %d, // Type Index' % font_index,
+            '    %s, // Vertical Metrics' % (new_name + '_VMetrics' if vmetrics else 'nullptr'),
+            '    %s_Ranges, // Unicode Ranges' % new_name,
+            '    sizeof(%s_Ranges) / sizeof(savaRange) // Range Count' % new_name,
+            '};', '', '#endif', '']
+
+    output = args.output or os.path.join(os.path.dirname(args.input), new_name + '.h')
+    with open(output, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out))
+    print('Записан %s (%s), диапазонов: %d' % (output, new_name, len(new_ranges)), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,51 @@
+#ifndef SF_7SEG_TEMPER_NM10X14_RLE_H
+#define SF_7SEG_TEMPER_NM10X14_RLE_H
+const uint16_t SF_7Seg_Temper_NM10x14_RLE_Offsets[] = {
+    0  , 7  , 23 , 34 , 50 , 66 , 80 , 96 , 112, 126, 142, 158, 
+    179, 184, 200, 219, 235, 244, 
+};
+
+const uint8_t SF_7Seg_Temper_NM10x14_RLE_Data[] = {
+    0x8A, 0x88, 0x00, 0x80, 0x30, 0x86, 0x00, // '.' (idx 0)
+    0x8A, 0x01, 0xBE, 0x1D, 0x84, 0x03, 0x03, 0x3D, 0x7E, 0x1F, 0x2F, 0x84, 0x30, 0x01, 0x2E, 0x1F, // '0' (idx 1)
+    0x8A, 0x86, 0x00, 0x01, 0x3C, 0x7E, 0x86, 0x00, 0x01, 0x0E, 0x1F, // '1' (idx 2)
+    0x8A, 0x01, 0x80, 0x41, 0x84, 0xC3, 0x03, 0xBD, 0x7E, 0x1F, 0x2F, 0x84, 0x30, 0x01, 0x20, 0x00, // '2' (idx 3)
+    0x8A, 0x01, 0x00, 0x41, 0x84, 0xC3, 0x03, 0xBD, 0x7E, 0x00, 0x20, 0x84, 0x30, 0x01, 0x2E, 0x1F, // '3' (idx 4)
+    0x8A, 0x01, 0x3E, 0x5C, 0x84, 0xC0, 0x01, 0xBC, 0x7E, 0x86, 0x00, 0x01, 0x0E, 0x1F, // '4' (idx 5)
+    0x8A, 0x01, 0x3E, 0x5D, 0x84, 0xC3, 0x03, 0x81, 0x00, 0x00, 0x20, 0x84, 0x30, 0x01, 0x2E, 0x1F, // '5' (idx 6)
+    0x8A, 0x01, 0xBE, 0x5D, 0x84, 0xC3, 0x03, 0x81, 0x00, 0x1F, 0x2F, 0x84, 0x30, 0x01, 0x2E, 0x1F, // '6' (idx 7)
+    0x8A, 0x01, 0x3E, 0x1D, 0x84, 0x03, 0x01, 0x3D, 0x7E, 0x86, 0x00, 0x01, 0x0E, 0x1F, // '7' (idx 8)
+    0x8A, 0x01, 0xBE, 0x5D, 0x84, 0xC3, 0x03, 0xBD, 0x7E, 0x1F, 0x2F, 0x84, 0x30, 0x01, 0x2E, 0x1F, // '8' (idx 9)
+    0x8A, 0x01, 0x3E, 0x5D, 0x84, 0xC3, 0x03, 0xBD, 0x7E, 0x00, 0x20, 0x84, 0x30, 0x01, 0x2E, 0x1F, // '9' (idx 10)
+    0x0A, 0x20, 0x60, 0xFE, 0xFC, 0x60, 0x40, 0x0E, 0x11, 0x11, 0x0E, 0x00, 0x00, 0x1F, 0x3F, 0x30, 0x30, 0x30, 0x18, 0x08, 0x00, // ':' (idx 11)
+    0x8A, 0x86, 0xC0, 0x8A, 0x00, // '-' (idx 12)
+    0x8A, 0x01, 0xBE, 0x7D, 0x84, 0x03, 0x03, 0x01, 0x00, 0x1F, 0x2F, 0x84, 0x30, 0x01, 0x20, 0x00, // '+' (idx 13)
+    0x8A, 0x07, 0x30, 0x7C, 0xFE, 0x5C, 0x30, 0x80, 0xC0, 0x80, 0x84, 0x00, 0x05, 0x06, 0x0F, 0x1F, 0x0B, 0x06, 0x00, // '/' (idx 14)
+    0x8A, 0x01, 0xBE, 0x5C, 0x84, 0xC0, 0x03, 0xBC, 0x7E, 0x1F, 0x0F, 0x84, 0x00, 0x01, 0x0E, 0x1F, // '*' (idx 15)
+    0x8A, 0x86, 0x98, 0x80, 0x00, 0x86, 0x01, 0x80, 0x00, // '=' (idx 16)
+    0x8A, 0x92, 0x00, // ' ' (idx 17)
+};
+
+const savaRange SF_7Seg_Temper_NM10x14_RLE_Ranges[] = {
+    { 0x0020, 1  , 17  }, // ' '
+    { 0x002A, 1  , 15  }, // '*'
+    { 0x002B, 1  , 13  }, // '+'
+    { 0x002D, 1  , 12  }, // '-'
+    { 0x002E, 1  , 0   }, // '.'
+    { 0x002F, 1  , 14  }, // '/'
+    { 0x0030, 10 , 1   }, // '0'..'9'
+    { 0x003A, 1  , 11  }, // ':'
+    { 0x003D, 1  , 16  }, // '='
+};
+
+const savaFont SF_7Seg_Temper_NM10x14_RLE = { 
+    (const uint8_t*)SF_7Seg_Temper_NM10x14_RLE_Data, 
+    (const uint16_t*)SF_7Seg_Temper_NM10x14_RLE_Offsets,
+    14, // Height
+    0, // Type Index
+    nullptr, // Vertical Metrics
+    SF_7Seg_Temper_NM10x14_RLE_Ranges, // Unicode Ranges
+    sizeof(SF_7Seg_Temper_NM10x14_RLE_Ranges) / sizeof(savaRange) // Range Count
+};
+
+#endif
@@ -14,7 +14,7 @@ const uint16_t SF_Font_P8_Offsets[] = {
     657, 666, 673, 681, 687, 693, 701, 707, 713, 719, 725, 730, 
     737, 743, 749, 755, 761, 767, 772, 778, 784, 790, 796, 802, 
     808, 814, 820, 826, 834, 840, 847, 853, 859, 866, 873, 881, 
-    887, 893, 901, 907, 913, 
+    887, 893, 901, 907, 913, 919, 923, 929, 
 };
 
 const uint8_t SF_Font_P8_Data[] = {
@@ -179,13 +179,28 @@ const uint8_t SF_Font_P8_Data[] = {
     0x05, 0x08, 0x54, 0x34, 0x14, 0x7C, // 'я' (idx 158)
     0x05, 0x7C, 0x55, 0x54, 0x55, 0x44, // 'Ё' (idx 159)
     0x05, 0x38, 0x55, 0x54, 0x55, 0x08, // 'ё' (idx 160)
+    0x03, 0x02, 0x05, 0x02, // '°' (idx 161)
+    0x05, 0x44, 0x44, 0x5F, 0x44, 0x44, // '±' (idx 162)
+    0x04, 0x7C, 0x10, 0x10, 0x1C, // 'µ' (idx 163)
+};
+
+const savaRange SF_Font_P8_Ranges[] = {
+    { 0x0020, 95 , 0   }, // ' '..'~'
+    { 0x00B0, 2  , 161 }, // '°', '±'
+    { 0x00B5, 1  , 163 }, // 'µ'
+    { 0x0401, 1  , 159 }, // 'Ё'
+    { 0x0410, 64 , 95  }, // 'А'..'я'
+    { 0x0451, 1  , 160 }, // 'ё'
 };
 
 const savaFont SF_Font_P8 = {
     (const uint8_t*)SF_Font_P8_Data,
     (const uint16_t*)SF_Font_P8_Offsets,
     8, // Height
-    1  // Type Index
+    1, // Type Index
+    nullptr, // Vertical Metrics
+    SF_Font_P8_Ranges, // Unicode Ranges
+    sizeof(SF_Font_P8_Ranges) / sizeof(savaRange) // Range Count
 };
 
 #endif
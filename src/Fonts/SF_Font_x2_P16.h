@@ -181,11 +181,21 @@ const uint8_t SF_Font_x2_P16_Data[] = {
     0x0A, 0xC0, 0xE0, 0x73, 0x33, 0x30, 0x30, 0x33, 0x73, 0xE0, 0xC0, 0x0F, 0x1F, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x08, // 'ё' (idx 160)
 };
 
+const savaRange SF_Font_x2_P16_Ranges[] = {
+    { 0x0020, 95 , 0   }, // ' '..'~'
+    { 0x0401, 1  , 159 }, // 'Ё'
+    { 0x0410, 64 , 95  }, // 'А'..'я'
+    { 0x0451, 1  , 160 }, // 'ё'
+};
+
 const savaFont SF_Font_x2_P16 = { 
     (const uint8_t*)SF_Font_x2_P16_Data, 
     (const uint16_t*)SF_Font_x2_P16_Offsets,
     16, // Height
-    1  // Type Index
+    1, // Type Index
+    nullptr, // Vertical Metrics
+    SF_Font_x2_P16_Ranges, // Unicode Ranges
+    sizeof(SF_Font_x2_P16_Ranges) / sizeof(savaRange) // Range Count
 };
 
 #endif
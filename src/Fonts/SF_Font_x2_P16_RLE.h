@@ -0,0 +1,201 @@
+#ifndef SF_FONT_X2_P16_RLE_H
+#define SF_FONT_X2_P16_RLE_H
+const uint16_t SF_Font_x2_P16_RLE_Offsets[] = {
+    0  , 3  , 7  , 17 , 29 , 41 , 62 , 83 , 88 , 101, 114, 126, 
+    138, 143, 148, 152, 170, 191, 201, 222, 241, 257, 275, 296, 
+    314, 334, 355, 358, 363, 376, 381, 394, 414, 426, 438, 450, 
+    462, 474, 484, 494, 506, 518, 526, 536, 548, 559, 575, 587, 
+    599, 609, 621, 633, 644, 656, 668, 680, 696, 708, 720, 731, 
+    739, 750, 758, 767, 772, 780, 792, 802, 814, 824, 836, 846, 
+    858, 868, 872, 880, 890, 894, 906, 916, 928, 940, 952, 961, 
+    970, 980, 990, 1002, 1014, 1026, 1036, 1045, 1053, 1057, 1065, 1085, 
+    1102, 1118, 1135, 1145, 1168, 1178, 1207, 1226, 1247, 1268, 1289, 1307, 
+    1330, 1342, 1362, 1374, 1387, 1407, 1419, 1437, 1465, 1486, 1500, 1513, 
+    1529, 1547, 1565, 1586, 1602, 1623, 1650, 1669, 1686, 1706, 1723, 1732, 
+    1755, 1774, 1795, 1813, 1834, 1855, 1872, 1892, 1913, 1925, 1945, 1957, 
+    1972, 1991, 2003, 2021, 2047, 2068, 2082, 2098, 2110, 2124, 2137, 2153, 
+    2165, 2185, 2212, 2231, 2243, 
+};
+
+const uint8_t SF_Font_x2_P16_RLE_Data[] = {
+    0x84, 0x86, 0x00, // ' ' (idx 0)
+    0x82, 0xC1, 0xFF, 0x30, // '!' (idx 1)
+    0x86, 0x05, 0x0B, 0x07, 0x00, 0x00, 0x0B, 0x07, 0x84, 0x00, // '\"' (idx 2)
+    0x8A, 0xC9, 0x30, 0xFF, 0x30, 0xFF, 0x30, 0x03, 0x3F, 0x03, 0x3F, 0x03, // '#' (idx 3)
+    0x8A, 0xC3, 0x30, 0xCC, 0xFF, 0xCC, 0x84, 0x0C, 0xC2, 0x3F, 0x0C, 0x03, // '$' (idx 4)
+    0x0A, 0x0E, 0x11, 0x11, 0x8E, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0C, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x1C, 0x22, 0x22, 0x1C, // '%' (idx 5)
+    0x0A, 0x3C, 0x7E, 0xC7, 0xE3, 0xF3, 0x3B, 0x1E, 0x0C, 0x00, 0x00, 0x0F, 0x1F, 0x39, 0x30, 0x31, 0x37, 0x1C, 0x0E, 0x3A, 0x33, // '&' (idx 6)
+    0x02, 0x0B, 0x07, 0x00, 0x00, // ''' (idx 7)
+    0x06, 0xE0, 0xF8, 0x3C, 0x0E, 0x07, 0x03, 0x01, 0x07, 0x0F, 0x1C, 0x38, 0x30, // '(' (idx 8)
+    0x06, 0x03, 0x07, 0x0E, 0x3C, 0xF8, 0xE0, 0x30, 0x38, 0x1C, 0x0F, 0x07, 0x01, // ')' (idx 9)
+    0x8A, 0xC7, 0x30, 0xF0, 0xFC, 0xF0, 0x30, 0x03, 0x03, 0x0F, 0x82, 0x03, // '*' (idx 10)
+    0x8A, 0x82, 0xC0, 0xC5, 0xFC, 0xC0, 0xC0, 0x00, 0x00, 0x0F, 0x82, 0x00, // '+' (idx 11)
+    0x02, 0x00, 0x00, 0xB0, 0x70, // ',' (idx 12)
+    0x88, 0x86, 0xC0, 0x86, 0x00, // '-' (idx 13)
+    0x82, 0xC1, 0x00, 0x30, // '.' (idx 14)
+    0x8A, 0x81, 0x00, 0x0B, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0C, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x83, 0x00, // '/' (idx 15)
+    0x0A, 0xFC, 0xFE, 0x07, 0x03, 0xC3, 0xC3, 0x33, 0x37, 0xFE, 0xFC, 0x0F, 0x1F, 0x3B, 0x33, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, // '0' (idx 16)
+    0x86, 0x01, 0x0C, 0x0E, 0xC4, 0xFF, 0x00, 0x30, 0x3F, 0x30, // '1' (idx 17)
+    0x0A, 0x0C, 0x0E, 0x07, 0x03, 0x03, 0x83, 0xC3, 0xE7, 0x7E, 0x3C, 0x30, 0x38, 0x3C, 0x3E, 0x37, 0x33, 0x31, 0x30, 0x30, 0x30, // '2' (idx 18)
+    0x8A, 0x82, 0x03, 0x08, 0x33, 0x7B, 0xFF, 0xCF, 0x87, 0x03, 0x0C, 0x1C, 0x38, 0x82, 0x30, 0x02, 0x39, 0x1F, 0x0F, // '3' (idx 19)
+    0x8A, 0x05, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0xC1, 0xFF, 0x00, 0x84, 0x03, 0xC1, 0x3F, 0x03, // '4' (idx 20)
+    0x8A, 0x80, 0x3F, 0x83, 0x33, 0x05, 0x73, 0xE3, 0xC3, 0x0C, 0x1C, 0x38, 0x82, 0x30, 0x02, 0x38, 0x1F, 0x0F, // '5' (idx 21)
+    0x0A, 0xF0, 0xF8, 0xDC, 0xCE, 0xC7, 0xC3, 0xC3, 0xC3, 0x80, 0x00, 0x0F, 0x1F, 0x39, 0x30, 0x30, 0x30, 0x30, 0x39, 0x1F, 0x0F, // '6' (idx 22)
+    0x8A, 0x81, 0x03, 0x06, 0x83, 0xC3, 0xE3, 0x73, 0x3B, 0x1F, 0x0F, 0xC1, 0x00, 0x3F, 0x00, 0x01, 0x83, 0x00, // '7' (idx 23)
+    0x8A, 0x02, 0x3C, 0x7E, 0xE7, 0x82, 0xC3, 0x05, 0xE7, 0x7E, 0x3C, 0x0E, 0x1F, 0x39, 0x82, 0x30, 0x02, 0x39, 0x1F, 0x0E, // '8' (idx 24)
+    0x0A, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0xFC, 0x00, 0x00, 0x30, 0x30, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, // '9' (idx 25)
+    0x82, 0x82, 0x30, // ':' (idx 26)
+    0x02, 0x30, 0x30, 0xB0, 0x70, // ';' (idx 27)
+    0x06, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0x0C, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x0C, // '<' (idx 28)
+    0x88, 0x86, 0x30, 0x86, 0x03, // '=' (idx 29)
+    0x06, 0x0C, 0x1C, 0x38, 0xF0, 0xE0, 0xC0, 0x0C, 0x0E, 0x07, 0x03, 0x01, 0x00, // '>' (idx 30)
+    0x8A, 0x09, 0x0C, 0x0E, 0x07, 0x03, 0x03, 0x83, 0xC3, 0xE7, 0x7E, 0x3C, 0x82, 0x00, 0x80, 0x33, 0x00, 0x01, 0x81, 0x00, // '?' (idx 31)
+    0x8A, 0xC9, 0x0C, 0xC3, 0xC3, 0x03, 0xFC, 0x0F, 0x30, 0x3F, 0x30, 0x0F, // '@' (idx 32)
+    0x8A, 0x80, 0xFC, 0x84, 0x03, 0xC1, 0xFC, 0x3F, 0x84, 0x03, 0x80, 0x3F, // 'A' (idx 33)
+    0x8A, 0x80, 0xFF, 0x84, 0xC3, 0xC1, 0x3C, 0x3F, 0x84, 0x30, 0x80, 0x0F, // 'B' (idx 34)
+    0x8A, 0x80, 0xFC, 0x84, 0x03, 0xC1, 0x0C, 0x0F, 0x84, 0x30, 0x80, 0x0C, // 'C' (idx 35)
+    0x8A, 0xC9, 0xFF, 0x03, 0x03, 0x0C, 0xF0, 0x3F, 0x30, 0x30, 0x0C, 0x03, // 'D' (idx 36)
+    0x8A, 0x80, 0xFF, 0x84, 0xC3, 0xC1, 0x03, 0x3F, 0x86, 0x30, // 'E' (idx 37)
+    0x8A, 0x80, 0xFF, 0x84, 0xC3, 0xC1, 0x03, 0x3F, 0x86, 0x00, // 'F' (idx 38)
+    0x8A, 0xC5, 0xFC, 0x03, 0xC3, 0xC3, 0xCC, 0x0F, 0x84, 0x30, 0x80, 0x3F, // 'G' (idx 39)
+    0x8A, 0x80, 0xFF, 0x84, 0xC0, 0xC1, 0xFF, 0x3F, 0x84, 0x00, 0x80, 0x3F, // 'H' (idx 40)
+    0x86, 0xC5, 0x03, 0xFF, 0x03, 0x30, 0x3F, 0x30, // 'I' (idx 41)
+    0x88, 0x82, 0x00, 0xC5, 0x03, 0xFF, 0x0C, 0x30, 0x30, 0x0F, // 'J' (idx 42)
+    0x8A, 0xC9, 0xFF, 0xC0, 0x30, 0x0C, 0x03, 0x3F, 0x00, 0x03, 0x0C, 0x30, // 'K' (idx 43)
+    0x8A, 0x80, 0xFF, 0x86, 0x00, 0x80, 0x3F, 0x84, 0x30, 0x80, 0x3C, // 'L' (idx 44)
+    0x8E, 0xCD, 0xFF, 0x0C, 0x30, 0xC0, 0x30, 0x0C, 0xFF, 0x3F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3F, // 'M' (idx 45)
+    0x8A, 0xC9, 0xFF, 0x30, 0xC0, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x03, 0x3F, // 'N' (idx 46)
+    0x8A, 0x80, 0xFC, 0x84, 0x03, 0xC1, 0xFC, 0x0F, 0x84, 0x30, 0x80, 0x0F, // 'O' (idx 47)
+    0x8A, 0x80, 0xFF, 0x84, 0xC3, 0xC1, 0x3C, 0x3F, 0x86, 0x00, // 'P' (idx 48)
+    0x8A, 0x80, 0xFC, 0x84, 0x03, 0xC5, 0xFC, 0x0F, 0x30, 0x33, 0x0C, 0x33, // 'Q' (idx 49)
+    0x8A, 0x80, 0xFF, 0x84, 0xC3, 0xC5, 0x3C, 0x3F, 0x00, 0x03, 0x0C, 0x30, // 'R' (idx 50)
+    0x8A, 0x80, 0x3C, 0x84, 0xC3, 0x80, 0x03, 0x86, 0x30, 0x80, 0x0F, // 'S' (idx 51)
+    0x8A, 0x82, 0x03, 0xC5, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x82, 0x00, // 'T' (idx 52)
+    0x8A, 0x80, 0xFF, 0x84, 0x00, 0xC1, 0xFF, 0x0F, 0x84, 0x30, 0x80, 0x0F, // 'U' (idx 53)
+    0x8A, 0x80, 0xFF, 0x84, 0x00, 0xC5, 0xFF, 0x03, 0x0C, 0x30, 0x0C, 0x03, // 'V' (idx 54)
+    0x8E, 0xCD, 0xFF, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xFF, 0x0F, 0x30, 0x0C, 0x03, 0x0C, 0x30, 0x0F, // 'W' (idx 55)
+    0x8A, 0xC9, 0x0F, 0x30, 0xC0, 0x30, 0x0F, 0x3C, 0x03, 0x00, 0x03, 0x3C, // 'X' (idx 56)
+    0x8A, 0xC7, 0x3F, 0xC0, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x3F, 0x82, 0x00, // 'Y' (idx 57)
+    0x8A, 0x82, 0x03, 0xC4, 0xC3, 0x33, 0x0F, 0x3C, 0x33, 0x84, 0x30, // 'Z' (idx 58)
+    0x86, 0xC3, 0xFF, 0x03, 0x03, 0x3F, 0x82, 0x30, // '[' (idx 59)
+    0x8C, 0xC2, 0x0C, 0x30, 0xC0, 0x8A, 0x00, 0xC2, 0x03, 0x0C, 0x30, // '\\' (idx 60)
+    0x86, 0x82, 0x03, 0xC3, 0xFF, 0x30, 0x30, 0x3F, // ']' (idx 61)
+    0x8A, 0xC4, 0x30, 0x0C, 0x03, 0x0C, 0x30, 0x88, 0x00, // '^' (idx 62)
+    0x88, 0x86, 0x00, 0x86, 0x30, // '_' (idx 63)
+    0x84, 0x03, 0x03, 0x07, 0x0E, 0x0C, 0x82, 0x00, // '`' (idx 64)
+    0x8A, 0x80, 0x00, 0x84, 0x30, 0xC1, 0xC0, 0x0C, 0x84, 0x33, 0x80, 0x3F, // 'a' (idx 65)
+    0x88, 0xC7, 0xFF, 0xC0, 0x30, 0xC0, 0x3F, 0x30, 0x30, 0x0F, // 'b' (idx 66)
+    0x8A, 0x80, 0xC0, 0x84, 0x30, 0xC1, 0x00, 0x0F, 0x84, 0x30, 0x80, 0x0C, // 'c' (idx 67)
+    0x88, 0xC7, 0xC0, 0x30, 0xC0, 0xFF, 0x0F, 0x30, 0x30, 0x3F, // 'd' (idx 68)
+    0x8A, 0x80, 0xC0, 0x84, 0x30, 0xC1, 0xC0, 0x0F, 0x84, 0x33, 0x80, 0x00, // 'e' (idx 69)
+    0x88, 0xC5, 0xC0, 0xFC, 0xC3, 0x0C, 0x00, 0x3F, 0x82, 0x00, // 'f' (idx 70)
+    0x8A, 0x80, 0xF0, 0x84, 0x0C, 0xC1, 0xFC, 0x00, 0x84, 0x33, 0x80, 0x0F, // 'g' (idx 71)
+    0x88, 0xC7, 0xFF, 0xC0, 0x30, 0xC0, 0x3F, 0x00, 0x00, 0x3F, // 'h' (idx 72)
+    0x82, 0xC1, 0xCC, 0x3F, // 'i' (idx 73)
+    0x86, 0x82, 0x00, 0xC3, 0xCC, 0x0C, 0x30, 0x0F, // 'j' (idx 74)
+    0x88, 0xC7, 0xFF, 0x00, 0xC0, 0x30, 0x3F, 0x03, 0x0C, 0x30, // 'k' (idx 75)
+    0x82, 0xC1, 0xFC, 0x3F, // 'l' (idx 76)
+    0x8A, 0xC9, 0xF0, 0x30, 0xC0, 0x30, 0xC0, 0x3F, 0x00, 0x03, 0x00, 0x3F, // 'm' (idx 77)
+    0x88, 0xC7, 0xF0, 0xC0, 0x30, 0xC0, 0x3F, 0x00, 0x00, 0x3F, // 'n' (idx 78)
+    0x8A, 0x80, 0xC0, 0x84, 0x30, 0xC1, 0xC0, 0x0F, 0x84, 0x30, 0x80, 0x0F, // 'o' (idx 79)
+    0x8A, 0x80, 0xF0, 0x84, 0x30, 0xC1, 0xC0, 0x3F, 0x84, 0x03, 0x80, 0x00, // 'p' (idx 80)
+    0x8A, 0x80, 0xC0, 0x84, 0x30, 0xC1, 0xF0, 0x00, 0x84, 0x03, 0x80, 0x3F, // 'q' (idx 81)
+    0x88, 0xC4, 0xF0, 0xC0, 0x30, 0xC0, 0x3F, 0x84, 0x00, // 'r' (idx 82)
+    0x88, 0x80, 0xC0, 0x86, 0x30, 0x82, 0x33, 0x80, 0x0C, // 's' (idx 83)
+    0x88, 0xC7, 0x30, 0xFF, 0x30, 0x00, 0x00, 0x0F, 0x30, 0x0C, // 't' (idx 84)
+    0x88, 0xC7, 0xF0, 0x00, 0x00, 0xF0, 0x0F, 0x30, 0x30, 0x3F, // 'u' (idx 85)
+    0x8A, 0x80, 0xF0, 0x84, 0x00, 0xC5, 0xF0, 0x03, 0x0C, 0x30, 0x0C, 0x03, // 'v' (idx 86)
+    0x8A, 0x80, 0xF0, 0x84, 0x00, 0xC5, 0xF0, 0x0F, 0x30, 0x0F, 0x30, 0x0F, // 'w' (idx 87)
+    0x8A, 0xC9, 0x30, 0xC0, 0x00, 0xC0, 0x30, 0x30, 0x0C, 0x03, 0x0C, 0x30, // 'x' (idx 88)
+    0x88, 0xC7, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x33, 0x33, 0x0F, // 'y' (idx 89)
+    0x88, 0x84, 0x30, 0xC4, 0xF0, 0x30, 0x3C, 0x33, 0x30, // 'z' (idx 90)
+    0x86, 0xC5, 0xC0, 0x3C, 0x03, 0x00, 0x0F, 0x30, // '{' (idx 91)
+    0x82, 0xC1, 0xFF, 0x3F, // '|' (idx 92)
+    0x86, 0xC5, 0x03, 0x3C, 0xC0, 0x30, 0x0F, 0x00, // '}' (idx 93)
+    0x8A, 0x09, 0xC0, 0x60, 0x30, 0x30, 0xE0, 0xC0, 0x80, 0x00, 0x80, 0xC0, 0x83, 0x00, 0x04, 0x01, 0x03, 0x03, 0x01, 0x00, // '~' (idx 94)
+    0x8A, 0x02, 0xFC, 0xFE, 0x07, 0x82, 0x03, 0x02, 0x07, 0xFE, 0xFC, 0x80, 0x3F, 0x84, 0x03, 0x80, 0x3F, // 'А' (idx 95)
+    0x8A, 0x80, 0xFF, 0x84, 0xC3, 0x01, 0x87, 0x07, 0x80, 0x3F, 0x83, 0x30, 0x02, 0x39, 0x1F, 0x0F, // 'Б' (idx 96)
+    0x8A, 0x80, 0xFF, 0x83, 0xC3, 0x02, 0xE7, 0x7E, 0x3C, 0x80, 0x3F, 0x83, 0x30, 0x02, 0x39, 0x1F, 0x0E, // 'В' (idx 97)
+    0x8A, 0x80, 0xFF, 0x84, 0x03, 0xC1, 0x07, 0x3F, 0x86, 0x00, // 'Г' (idx 98)
+    0x8C, 0x80, 0x00, 0x02, 0xFC, 0xFE, 0x07, 0x81, 0x03, 0xC1, 0xFF, 0x00, 0x01, 0x38, 0x3C, 0xC3, 0x0F, 0x0C, 0x0C, 0x0F, 0x01, 0x3C, 0x38, // 'Д' (idx 99)
+    0x8A, 0x80, 0xFF, 0x84, 0xC3, 0xC1, 0x03, 0x3F, 0x86, 0x30, // 'Е' (idx 100)
+    0x0E, 0x0F, 0x1F, 0x38, 0x30, 0xE0, 0xC0, 0xFF, 0xFF, 0xC0, 0xE0, 0x30, 0x38, 0x1F, 0x0F, 0x3C, 0x3E, 0x07, 0x03, 0x01, 0x00, 0x3F, 0x3F, 0x00, 0x01, 0x03, 0x07, 0x3E, 0x3C, // 'Ж' (idx 101)
+    0x8A, 0x82, 0x03, 0x08, 0x33, 0x7B, 0xFF, 0xCF, 0x87, 0x03, 0x0C, 0x1C, 0x38, 0x82, 0x30, 0x02, 0x39, 0x1F, 0x0F, // 'З' (idx 102)
+    0x0A, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xFF, 0xFF, 0x3F, 0x3F, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x3F, 0x3F, // 'И' (idx 103)
+    0x0A, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x83, 0xC0, 0xE0, 0xFF, 0xFF, 0x3F, 0x3F, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x3F, 0x3F, // 'Й' (idx 104)
+    0x0A, 0xFF, 0xFF, 0xC0, 0xE0, 0xF0, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x3F, 0x3F, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x30, // 'К' (idx 105)
+    0x8A, 0x04, 0x00, 0x80, 0xFC, 0xFE, 0x07, 0x81, 0x03, 0xC1, 0xFF, 0x3F, 0x00, 0x01, 0x83, 0x00, 0x80, 0x3F, // 'Л' (idx 106)
+    0x8E, 0x80, 0xFF, 0x09, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0xC7, 0xFF, 0x3F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3F, // 'М' (idx 107)
+    0x8A, 0x80, 0xFF, 0x84, 0xC0, 0xC1, 0xFF, 0x3F, 0x84, 0x00, 0x80, 0x3F, // 'Н' (idx 108)
+    0x8A, 0x02, 0xFC, 0xFE, 0x07, 0x82, 0x03, 0x05, 0x07, 0xFE, 0xFC, 0x0F, 0x1F, 0x38, 0x82, 0x30, 0x02, 0x38, 0x1F, 0x0F, // 'О' (idx 109)
+    0x8A, 0x80, 0xFF, 0x84, 0x03, 0xC1, 0xFF, 0x3F, 0x84, 0x00, 0x80, 0x3F, // 'П' (idx 110)
+    0x8A, 0x80, 0xFF, 0x83, 0xC3, 0x02, 0xE7, 0x7E, 0x3C, 0x80, 0x3F, 0x86, 0x00, // 'Р' (idx 111)
+    0x8A, 0x02, 0xFC, 0xFE, 0x07, 0x82, 0x03, 0x05, 0x07, 0x0E, 0x0C, 0x0F, 0x1F, 0x38, 0x82, 0x30, 0x02, 0x38, 0x1C, 0x0C, // 'С' (idx 112)
+    0x8A, 0x82, 0x03, 0xC5, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x82, 0x00, // 'Т' (idx 113)
+    0x8A, 0x02, 0x3F, 0x7F, 0xE0, 0x83, 0xC0, 0x80, 0xFF, 0x01, 0x08, 0x18, 0x83, 0x30, 0x02, 0x38, 0x1F, 0x0F, // 'У' (idx 114)
+    0x8E, 0x02, 0xF0, 0xF8, 0x1C, 0x81, 0x0C, 0x80, 0xFF, 0x81, 0x0C, 0x05, 0x1C, 0xF8, 0xF0, 0x03, 0x07, 0x0E, 0x81, 0x0C, 0x80, 0x3F, 0x81, 0x0C, 0x02, 0x0E, 0x07, 0x03, // 'Ф' (idx 115)
+    0x0A, 0x0F, 0x1F, 0x38, 0xF0, 0xE0, 0xE0, 0xF0, 0x38, 0x1F, 0x0F, 0x3C, 0x3E, 0x07, 0x03, 0x01, 0x01, 0x03, 0x07, 0x3E, 0x3C, // 'Х' (idx 116)
+    0x8C, 0x80, 0xFF, 0x84, 0x00, 0xC2, 0xFF, 0x00, 0x3F, 0x84, 0x30, 0xC1, 0x3F, 0xF0, // 'Ц' (idx 117)
+    0x8A, 0x02, 0x3F, 0x7F, 0xE0, 0x83, 0xC0, 0x80, 0xFF, 0x86, 0x00, 0x80, 0x3F, // 'Ч' (idx 118)
+    0x8E, 0xCD, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x3F, 0x30, 0x30, 0x3F, 0x30, 0x30, 0x3F, // 'Ш' (idx 119)
+    0x90, 0xCF, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0x30, 0x30, 0x3F, 0x30, 0x30, 0x3F, 0xF0, // 'Щ' (idx 120)
+    0x8C, 0xC1, 0x03, 0xFF, 0x84, 0xC0, 0x00, 0x80, 0x81, 0x00, 0x80, 0x3F, 0x83, 0x30, 0x02, 0x39, 0x1F, 0x0F, // 'Ъ' (idx 121)
+    0x8E, 0x80, 0xFF, 0x84, 0xC0, 0x00, 0x80, 0x81, 0x00, 0xC1, 0xFF, 0x3F, 0x83, 0x30, 0x02, 0x39, 0x1F, 0x0F, 0xC1, 0x00, 0x3F, // 'Ы' (idx 122)
+    0x8A, 0x80, 0xFF, 0x84, 0xC0, 0x01, 0x80, 0x00, 0x80, 0x3F, 0x83, 0x30, 0x02, 0x39, 0x1F, 0x0F, // 'Ь' (idx 123)
+    0x0A, 0x0C, 0x0E, 0x07, 0x03, 0xC3, 0xC3, 0xC3, 0xC7, 0xFE, 0xFC, 0x0C, 0x1C, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, // 'Э' (idx 124)
+    0x8E, 0xC1, 0xFF, 0xC0, 0x02, 0xFC, 0xFE, 0x07, 0x82, 0x03, 0x02, 0x07, 0xFE, 0xFC, 0xC1, 0x3F, 0x00, 0x02, 0x0F, 0x1F, 0x38, 0x82, 0x30, 0x02, 0x38, 0x1F, 0x0F, // 'Ю' (idx 125)
+    0x8A, 0x02, 0x3C, 0x7E, 0xE7, 0x83, 0xC3, 0x80, 0xFF, 0x05, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0xC1, 0x00, 0x3F, // 'Я' (idx 126)
+    0x8A, 0x01, 0x40, 0x20, 0x84, 0x30, 0x03, 0xE0, 0xC0, 0x0C, 0x1E, 0x83, 0x33, 0x02, 0x13, 0x1F, 0x3F, // 'а' (idx 127)
+    0x8A, 0x0B, 0xF0, 0xF8, 0xDC, 0xCC, 0xCC, 0xCE, 0xC7, 0xC3, 0x83, 0x03, 0x0F, 0x1F, 0x83, 0x30, 0x02, 0x39, 0x1F, 0x0F, // 'б' (idx 128)
+    0x8A, 0x80, 0xF0, 0x83, 0x30, 0x02, 0x70, 0xE0, 0xC0, 0x80, 0x3F, 0x83, 0x33, 0x02, 0x3B, 0x1F, 0x0C, // 'в' (idx 129)
+    0x88, 0x80, 0xF0, 0x84, 0x30, 0x80, 0x3F, 0x84, 0x00, // 'г' (idx 130)
+    0x8C, 0x80, 0x00, 0x02, 0xC0, 0xE0, 0x70, 0x81, 0x30, 0xC1, 0xF0, 0x00, 0x01, 0xE0, 0xF0, 0xC3, 0x3F, 0x30, 0x30, 0x3F, 0x01, 0xF0, 0xE0, // 'д' (idx 131)
+    0x8A, 0x02, 0xC0, 0xE0, 0x70, 0x82, 0x30, 0x05, 0x70, 0xE0, 0xC0, 0x0F, 0x1F, 0x3B, 0x83, 0x33, 0x01, 0x11, 0x08, // 'е' (idx 132)
+    0x0A, 0xF0, 0xF0, 0x80, 0x00, 0xF0, 0xF0, 0x00, 0x80, 0xF0, 0xF0, 0x3C, 0x3C, 0x07, 0x03, 0x3F, 0x3F, 0x03, 0x07, 0x3C, 0x3C, // 'ж' (idx 133)
+    0x89, 0x00, 0x60, 0x83, 0x30, 0x0B, 0x70, 0xE0, 0xC0, 0x18, 0x30, 0x30, 0x32, 0x33, 0x33, 0x3B, 0x1F, 0x0C, // 'з' (idx 134)
+    0x0A, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0x3F, 0x3F, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x3F, 0x3F, // 'и' (idx 135)
+    0x0A, 0xF0, 0xF0, 0x02, 0x06, 0x0C, 0x8C, 0xC6, 0xE2, 0xF0, 0xF0, 0x3F, 0x3F, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x3F, 0x3F, // 'й' (idx 136)
+    0x08, 0xF0, 0xF0, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x30, 0x3F, 0x3F, 0x03, 0x03, 0x0F, 0x1C, 0x38, 0x30, // 'к' (idx 137)
+    0x8A, 0x80, 0x00, 0x02, 0xC0, 0xE0, 0x70, 0x81, 0x30, 0x80, 0xF0, 0x03, 0x30, 0x38, 0x1F, 0x0F, 0x82, 0x00, 0x80, 0x3F, // 'л' (idx 138)
+    0x0A, 0xF0, 0xF0, 0xE0, 0xC0, 0x80, 0x80, 0xC0, 0xE0, 0xF0, 0xF0, 0x3F, 0x3F, 0x00, 0x01, 0x07, 0x07, 0x01, 0x00, 0x3F, 0x3F, // 'м' (idx 139)
+    0x8A, 0x80, 0xF0, 0x84, 0x00, 0xC1, 0xF0, 0x3F, 0x84, 0x03, 0x80, 0x3F, // 'н' (idx 140)
+    0x8A, 0x02, 0xC0, 0xE0, 0x70, 0x82, 0x30, 0x05, 0x70, 0xE0, 0xC0, 0x0F, 0x1F, 0x38, 0x82, 0x30, 0x02, 0x38, 0x1F, 0x0F, // 'о' (idx 141)
+    0x8A, 0x80, 0xF0, 0x84, 0x30, 0xC1, 0xF0, 0x3F, 0x84, 0x00, 0x80, 0x3F, // 'п' (idx 142)
+    0x8A, 0x80, 0xF0, 0x84, 0x30, 0x01, 0xE0, 0xC0, 0x80, 0x3F, 0x84, 0x03, 0x01, 0x01, 0x00, // 'р' (idx 143)
+    0x8A, 0x02, 0xC0, 0xE0, 0x70, 0x83, 0x30, 0x80, 0x00, 0x02, 0x0F, 0x1F, 0x38, 0x82, 0x30, 0x02, 0x38, 0x18, 0x0C, // 'с' (idx 144)
+    0x8A, 0x82, 0x30, 0xC5, 0xF0, 0x30, 0x30, 0x00, 0x00, 0x3F, 0x82, 0x00, // 'т' (idx 145)
+    0x8A, 0x80, 0xF0, 0x00, 0x80, 0x83, 0x00, 0x80, 0xF0, 0x01, 0x08, 0x11, 0x83, 0x33, 0x02, 0x3B, 0x1F, 0x0F, // 'у' (idx 146)
+    0x8E, 0x01, 0x00, 0x80, 0x82, 0xC0, 0x80, 0xF0, 0x82, 0xC0, 0x04, 0x80, 0x00, 0x0F, 0x1F, 0x39, 0x81, 0x30, 0x80, 0xFF, 0x81, 0x30, 0x02, 0x39, 0x1F, 0x0F, // 'ф' (idx 147)
+    0x0A, 0x30, 0x70, 0xE0, 0xC0, 0x00, 0x00, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x38, 0x1C, 0x0F, 0x03, 0x03, 0x0F, 0x1C, 0x38, 0x30, // 'х' (idx 148)
+    0x8C, 0x80, 0xF0, 0x84, 0x00, 0xC2, 0xF0, 0x00, 0x3F, 0x84, 0x30, 0xC1, 0x3F, 0xF0, // 'ц' (idx 149)
+    0x8A, 0x80, 0xF0, 0x00, 0x80, 0x83, 0x00, 0x80, 0xF0, 0x01, 0x00, 0x01, 0x84, 0x03, 0x80, 0x3F, // 'ч' (idx 150)
+    0x8A, 0xC9, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x3F, 0x30, 0x3F, 0x30, 0x3F, // 'ш' (idx 151)
+    0x8C, 0xCB, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x3F, 0x30, 0x3F, 0x30, 0x3F, 0xF0, // 'щ' (idx 152)
+    0x8C, 0xC1, 0x30, 0xF0, 0x88, 0x00, 0x80, 0x3F, 0x84, 0x33, 0x01, 0x1E, 0x0C, // 'ъ' (idx 153)
+    0x8E, 0x80, 0xF0, 0x88, 0x00, 0xC1, 0xF0, 0x3F, 0x84, 0x33, 0x01, 0x1E, 0x0C, 0xC1, 0x00, 0x3F, // 'ы' (idx 154)
+    0x8A, 0x80, 0xF0, 0x86, 0x00, 0x80, 0x3F, 0x84, 0x33, 0x01, 0x1E, 0x0C, // 'ь' (idx 155)
+    0x8A, 0x01, 0xC0, 0x60, 0x83, 0x30, 0x04, 0x70, 0xE0, 0xC0, 0x0C, 0x18, 0x80, 0x30, 0x81, 0x33, 0x02, 0x3B, 0x1F, 0x0F, // 'э' (idx 156)
+    0x8E, 0xC1, 0xF0, 0x00, 0x02, 0xC0, 0xE0, 0x70, 0x82, 0x30, 0x02, 0x70, 0xE0, 0xC0, 0xC1, 0x3F, 0x03, 0x02, 0x0F, 0x1F, 0x38, 0x82, 0x30, 0x02, 0x38, 0x1F, 0x0F, // 'ю' (idx 157)
+    0x8A, 0x01, 0xC0, 0xE0, 0x83, 0x30, 0x08, 0x20, 0xF0, 0xF0, 0x00, 0x01, 0x33, 0x3B, 0x1F, 0x0F, 0xC1, 0x03, 0x3F, // 'я' (idx 158)
+    0x8A, 0xC5, 0xF0, 0x33, 0x30, 0x33, 0x30, 0x3F, 0x84, 0x33, 0x80, 0x30, // 'Ё' (idx 159)
+    0x8A, 0x0C, 0xC0, 0xE0, 0x73, 0x33, 0x30, 0x30, 0x33, 0x73, 0xE0, 0xC0, 0x0F, 0x1F, 0x3B, 0x83, 0x33, 0x01, 0x11, 0x08, // 'ё' (idx 160)
+};
+
+const savaRange SF_Font_x2_P16_RLE_Ranges[] = {
+    { 0x0020, 95 , 0   }, // ' '..'~'
+    { 0x0401, 1  , 159 }, // 'Ё'
+    { 0x0410, 64 , 95  }, // 'А'..'я'
+    { 0x0451, 1  , 160 }, // 'ё'
+};
+
+const savaFont SF_Font_x2_P16_RLE = { 
+    (const uint8_t*)SF_Font_x2_P16_RLE_Data, 
+    (const uint16_t*)SF_Font_x2_P16_RLE_Offsets,
+    16, // Height
+    1, // Type Index
+    nullptr, // Vertical Metrics
+    SF_Font_x2_P16_RLE_Ranges, // Unicode Ranges
+    sizeof(SF_Font_x2_P16_RLE_Ranges) / sizeof(savaRange) // Range Count
+};
+
+#endif
@@ -26,11 +26,26 @@ const uint8_t SF_Icon_NP8_Data[] = {
     0x09, 0x80, 0x00, 0xC0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xFF, // ' ' (idx 17)
 };
 
+const savaRange SF_Icon_NP8_Ranges[] = {
+    { 0x0020, 1  , 17  }, // ' '
+    { 0x002A, 1  , 15  }, // '*'
+    { 0x002B, 1  , 13  }, // '+'
+    { 0x002D, 1  , 12  }, // '-'
+    { 0x002E, 1  , 0   }, // '.'
+    { 0x002F, 1  , 14  }, // '/'
+    { 0x0030, 10 , 1   }, // '0'..'9'
+    { 0x003A, 1  , 11  }, // ':'
+    { 0x003D, 1  , 16  }, // '='
+};
+
 const savaFont SF_Icon_NP8 = {
     (const uint8_t*)SF_Icon_NP8_Data,
     (const uint16_t*)SF_Icon_NP8_Offsets,
     8, // Height
-    0  // Type Index
+    0, // Type Index
+    nullptr, // Vertical Metrics
+    SF_Icon_NP8_Ranges, // Unicode Ranges
+    sizeof(SF_Icon_NP8_Ranges) / sizeof(savaRange) // Range Count
 };
 
 #endif
@@ -181,11 +181,45 @@ const uint8_t SF_Vertical_P8_Data[] = {
     0x07, 0x0E, 0x01, 0x0F, 0x11, 0x0E, 0x00, 0x0A, // 'ё' (idx 160)
 };
 
+const uint8_t SF_Vertical_P8_VMetrics[] = {
+    8, 2, 0, 1, 0, 3, 0, 5, 0, 5, 0, 5, 0, 5, 0, 2, 
+    0, 3, 0, 3, 0, 5, 0, 5, 0, 2, 0, 4, 0, 1, 0, 5, 
+    0, 5, 0, 3, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 
+    0, 5, 0, 5, 0, 1, 0, 2, 0, 3, 0, 4, 0, 3, 0, 5, 
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 
+    0, 5, 0, 3, 0, 4, 0, 5, 0, 5, 0, 7, 0, 5, 0, 5, 
+    0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 7, 
+    0, 5, 0, 5, 0, 5, 0, 3, 0, 6, 0, 3, 0, 5, 0, 4, 
+    0, 2, 0, 5, 0, 4, 0, 5, 0, 4, 0, 5, 0, 4, 0, 5, 
+    0, 4, 0, 1, 0, 3, 0, 4, 0, 1, 0, 5, 0, 4, 0, 5, 
+    0, 5, 0, 5, 0, 4, 0, 4, 0, 4, 0, 4, 0, 5, 0, 5, 
+    0, 5, 0, 4, 0, 4, 0, 3, 0, 1, 0, 3, 0, 5, 0, 5, 
+    0, 5, 0, 5, 0, 5, 0, 6, 0, 5, 0, 7, 0, 5, 0, 5, 
+    0, 5, 0, 5, 0, 5, 0, 7, 0, 5, 0, 5, 0, 5, 0, 5, 
+    0, 5, 0, 5, 0, 5, 0, 7, 0, 5, 0, 6, 0, 5, 0, 7, 
+    0, 8, 0, 6, 0, 7, 0, 5, 0, 5, 0, 7, 0, 5, 0, 5, 
+    0, 5, 0, 5, 0, 4, 0, 6, 0, 5, 0, 5, 0, 5, 0, 5, 
+    0, 5, 0, 4, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 
+    0, 5, 0, 5, 0, 5, 0, 7, 0, 5, 0, 6, 0, 5, 0, 5, 
+    0, 6, 0, 6, 0, 7, 0, 5, 0, 5, 0, 7, 0, 5, 0, 5, 
+    0, 5, 
+};
+
+const savaRange SF_Vertical_P8_Ranges[] = {
+    { 0x0020, 95 , 0   }, // ' '..'~'
+    { 0x0401, 1  , 159 }, // 'Ё'
+    { 0x0410, 64 , 95  }, // 'А'..'я'
+    { 0x0451, 1  , 160 }, // 'ё'
+};
+
 const savaFont SF_Vertical_P8 = { 
     (const uint8_t*)SF_Vertical_P8_Data, 
     (const uint16_t*)SF_Vertical_P8_Offsets,
     8, // Height
-    1  // Type Index
+    1, // Type Index
+    SF_Vertical_P8_VMetrics, // Vertical Metrics
+    SF_Vertical_P8_Ranges, // Unicode Ranges
+    sizeof(SF_Vertical_P8_Ranges) / sizeof(savaRange) // Range Count
 };
 
 #endif
@@ -31,30 +31,545 @@ OLED_SET_NORMAL_DISPLAY,
 OLED_DISPLAY_ON
 };
 
-// Функция-декодер UTF-8 -> CP1251. Возвращает индекс в массиве шрифтов.
-static uint16_t utf8_to_cp1251(uint8_t high, uint8_t low) {
-    if (high == 0xD0) {
-        if (low == 0x81) return 0xA8; // Ё   // ---- Стандартный код CP1251
-        if (low >= 0x90 && low <= 0xBF) return low + 0x30; // А-п
-    } else if (high == 0xD1) {
-        if (low == 0x91) return 0xB8; // ё   // ---- Стандартный код CP1251
-        if (low >= 0x80 && low <= 0x8F) return low + 0x70; // р-я
-    }
+// Перевод кодовой точки Unicode в CP1251 (для старых шрифтов без таблицы диапазонов).
+static uint16_t unicode_to_cp1251(uint32_t code_point) {
+    if (code_point < 0x80) return code_point;
+    if (code_point >= 0x0410 && code_point <= 0x044F) return code_point - 0x0410 + 0xC0; // А-я
+    if (code_point == 0x0401) return 0xA8; // Ё   // ---- Стандартный код CP1251
+    if (code_point == 0x0451) return 0xB8; // ё   // ---- Стандартный код CP1251
     return '?';
 }
 
+// Прочитать следующий символ UTF-8 (1..4 байта) фрагмента длиной length, начиная с позиции i (сдвигает i).
+// Ошибочная, обрезанная или избыточная (overlong) последовательность -> '?', сдвиг на 1 байт.
+static uint32_t utf8_next(const char* text, uint16_t length, uint16_t &i) {
+    uint8_t lead = (uint8_t)text[i];
+    if (lead < 0x80) {
+        i++;
+        return lead;
+    }
+    uint8_t extra;
+    uint32_t code_point;
+    uint32_t min_code;
+    if ((lead & 0xE0) == 0xC0)      { extra = 1; code_point = lead & 0x1F; min_code = 0x80; }
+    else if ((lead & 0xF0) == 0xE0) { extra = 2; code_point = lead & 0x0F; min_code = 0x800; }
+    else if ((lead & 0xF8) == 0xF0) { extra = 3; code_point = lead & 0x07; min_code = 0x10000; }
+    else { // продолжающий байт без начала или недопустимый байт
+        i++;
+        return '?';
+    }
+    if (i + extra >= length) { // обрезанная последовательность в конце фрагмента
+        i++;
+        return '?';
+    }
+    for (uint8_t k = 1; k <= extra; k++) {
+        uint8_t cont = (uint8_t)text[i + k];
+        if ((cont & 0xC0) != 0x80) {
+            i++;
+            return '?';
+        }
+        code_point = (code_point << 6) | (cont & 0x3F);
+    }
+    if (code_point < min_code || code_point > 0x10FFFF || (code_point >= 0xD800 && code_point <= 0xDFFF)) {
+        i++;
+        return '?';
+    }
+    i += extra + 1;
+    return code_point;
+}
+
+// Двоичный поиск кодовой точки в отсортированной таблице диапазонов шрифта.
+static uint16_t find_range_index(const savaRange* ranges, uint8_t count, uint32_t code_point) {
+    uint8_t lo = 0;
+    uint8_t hi = count;
+    while (lo < hi) {
+        uint8_t mid = (lo + hi) / 2;
+        const savaRange &r = ranges[mid];
+        if (code_point < r.first) hi = mid;
+        else if (code_point - r.first >= r.count) lo = mid + 1;
+        else return r.index + (code_point - r.first);
+    }
+    return 0xFFFF;
+}
+
+// --- Сжатые символы и картинки (RLE) ---
+// Токены: 0x00..0x7F - литерал (t + 1 байт), 0x80..0xBF - повтор следующего байта (t - 0x80 + 2 раз),
+// 0xC0..0xFF - парные колонки (t - 0xC0 + 1 байт, каждый выводится дважды).
+// Поток разворачивается в порядке несжатых данных: [страница 0: колонки] [страница 1: колонки] ...
+struct RleStream {
+    const uint8_t* src;
+    uint8_t run = 0;     // сколько байт осталось выдать по текущему токену
+    uint8_t kind = 0;    // 0 - литерал, 1 - повтор, 2 - парные колонки
+    uint8_t value = 0;
+
+    explicit RleStream(const uint8_t* data) : src(data) {}
+
+    uint8_t next() {
+        if (run == 0) {
+            uint8_t token = *src++;
+            if (token < 0x80) { kind = 0; run = token + 1; }
+            else if (token < 0xC0) { kind = 1; run = (token & 0x3F) + 2; value = *src++; }
+            else { kind = 2; run = ((token & 0x3F) + 1) * 2; }
+        }
+        run--;
+        if (kind == 0) return *src++;
+        if (kind == 2 && (run & 1)) value = *src++; // первый байт пары - новый
+        return value;
+    }
+};
+
+// Маска строк [y0, y1) внутри страницы page (бит 0 - верхняя строка страницы)
+static inline uint8_t page_rows_mask(int16_t page, int16_t y0, int16_t y1) {
+    int16_t top = page * 8;
+    int16_t from = (y0 > top) ? (y0 - top) : 0;
+    int16_t to = (y1 < top + 8) ? (y1 - top) : 8;
+    if (from >= to) return 0;
+    return (uint8_t)((0xFF << from) & (0xFF >> (8 - to)));
+}
+
+// Ширина символа без флага сжатия
+static inline uint8_t glyph_width(const uint8_t* char_ptr) {
+    return *char_ptr & ~FONT_RLE_FLAG;
+}
+
+// Собрать колонки символа (до 4 страниц) в 32-битные слова, сжатого или нет. Возвращает ширину.
+static uint8_t glyph_columns(const uint8_t* char_ptr, uint8_t pages_per_char, uint32_t* cols) {
+    uint8_t width = glyph_width(char_ptr);
+    const uint8_t* pixels = char_ptr + 1;
+    uint8_t pages = (pages_per_char < 4) ? pages_per_char : 4;
+    memset(cols, 0, width * sizeof(uint32_t));
+    if (*char_ptr & FONT_RLE_FLAG) {
+        RleStream stream(pixels);
+        for (uint8_t p = 0; p < pages; p++) {
+            for (uint8_t col = 0; col < width; col++) cols[col] |= (uint32_t)stream.next() << (p * 8);
+        }
+    } else {
+        for (uint8_t p = 0; p < pages; p++) {
+            for (uint8_t col = 0; col < width; col++) cols[col] |= (uint32_t)pixels[p * width + col] << (p * 8);
+        }
+    }
+    return width;
+}
+
+// Колонки символа (до 4 страниц) по одной слева направо - без массива на весь символ.
+// У сжатого символа на каждую страницу свой поток, заранее перемотанный к началу её строки.
+struct GlyphColumnReader {
+    const uint8_t* pixels = nullptr;
+    uint8_t width = 0;
+    uint8_t pages = 0;
+    uint8_t col = 0;
+    bool rle = false;
+    RleStream streams[4] = { RleStream(nullptr), RleStream(nullptr), RleStream(nullptr), RleStream(nullptr) };
+
+    // char_ptr = nullptr - пустой символ (все колонки 0)
+    GlyphColumnReader(const uint8_t* char_ptr, uint8_t pages_per_char) {
+        if (!char_ptr) return;
+        pixels = char_ptr + 1;
+        width = glyph_width(char_ptr);
+        pages = (pages_per_char < 4) ? pages_per_char : 4;
+        rle = *char_ptr & FONT_RLE_FLAG;
+        if (!rle) return;
+        streams[0] = RleStream(pixels);
+        for (uint8_t p = 1; p < pages; p++) {
+            streams[p] = streams[p - 1];
+            for (uint8_t k = 0; k < width; k++) streams[p].next();
+        }
+    }
+
+    // Следующая колонка (бит 0 - верхняя строка символа); за шириной символа - 0
+    uint32_t next() {
+        if (col >= width) return 0;
+        uint32_t column = 0;
+        if (rle) {
+            for (uint8_t p = 0; p < pages; p++) column |= (uint32_t)streams[p].next() << (p * 8);
+        } else {
+            for (uint8_t p = 0; p < pages; p++) column |= (uint32_t)pixels[p * width + col] << (p * 8);
+        }
+        col++;
+        return column;
+    }
+};
+
+// Сдвинуть колонки [x0, x0 + w) блока из pages страниц вниз на shift бит (0 < shift < 8).
+// Блок занимает pages + 1 строк с шагом stride: в нижнюю строку уходят вытесненные биты.
+static void shift_columns(uint8_t* rows, uint16_t stride, uint16_t x0, uint16_t w, uint8_t pages, uint8_t shift) {
+    for (uint16_t x = x0; x < x0 + w; x++) {
+        uint8_t carry = 0;
+        for (uint8_t p = 0; p <= pages; p++) {
+            uint8_t* cell = rows + p * stride + x;
+            uint8_t data = (p < pages) ? *cell : 0;
+            *cell = (data << shift) | carry;
+            carry = data >> (8 - shift);
+        }
+    }
+}
+
+// --- Масштабирование символов: растяжение битов колонки через таблицы ---
+// Каждый бит полубайта повторяется scale раз (младший бит - верхний пиксель).
+static const uint8_t SPREAD2_LUT[16] = {
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F, 0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF
+};
+static const uint16_t SPREAD3_LUT[16] = {
+    0x0000, 0x0007, 0x0038, 0x003F, 0x01C0, 0x01C7, 0x01F8, 0x01FF, 0x0E00, 0x0E07, 0x0E38, 0x0E3F, 0x0FC0, 0x0FC7, 0x0FF8, 0x0FFF
+};
+static const uint16_t SPREAD4_LUT[16] = {
+    0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF, 0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF
+};
+
+// Масштаб, с которым шрифт реально рисуется: высота после растяжения не больше буфера строки (max_pixels)
+static uint8_t fit_scale(const savaFont* fontPtr, uint8_t scale, uint16_t max_pixels) {
+    uint8_t glyph_height = (fontPtr->height < 32) ? fontPtr->height : 32;
+    if (scale < 1) scale = 1;
+    while (scale > 1 && glyph_height * scale > max_pixels) scale--;
+    return scale;
+}
+
+// Растянуть колонку символа (height бит) по вертикали в scale раз. height * scale <= 64.
+static uint64_t spread_column(uint32_t column, uint8_t height, uint8_t scale) {
+    uint64_t out = 0;
+    uint8_t step = 4 * scale;
+    for (uint8_t n = 0; n * 4 < height; n++) {
+        uint8_t nibble = (column >> (n * 4)) & 0x0F;
+        if (!nibble) continue;
+        uint64_t part = (scale == 2) ? SPREAD2_LUT[nibble] : (scale == 3) ? SPREAD3_LUT[nibble] : SPREAD4_LUT[nibble];
+        out |= part << (n * step);
+    }
+    return out;
+}
+
+// --- Очередь команд ---
+static const uint8_t CMD_WIDGET = 0xFF; // Служебный тип в кольце: отметка «у виджета cmd.widget новая команда»
+
+// Длина текста не больше max байт без разрыва символа UTF-8
+static size_t utf8_clip(const char* text, size_t max) {
+    size_t len = strnlen(text, max + 1);
+    if (len <= max) return len;
+    len = max;
+    while (len > 0 && ((uint8_t)text[len] & 0xC0) == 0x80) len--;
+    return len;
+}
+
+// --- Холсты вне экрана ---
+// Строка страницы экрана из страниц холста: lo даёт верхние строки (сдвиг вниз на shift), hi - нижние строки
+// предыдущей страницы холста. Одна запись на байт по маске cover (строки прямоугольника и окна отсечения).
+static void blit_row(uint8_t* dest, const uint8_t* lo, const uint8_t* hi, uint8_t shift, uint8_t cover, uint16_t count, uint8_t mode) {
+    uint8_t lo_mask = lo ? (uint8_t)(0xFF << shift) : 0;
+    uint8_t hi_mask = hi ? (uint8_t)(0xFF >> (8 - shift)) : 0;
+    uint8_t mask = (lo_mask | hi_mask) & cover;
+    if (!mask) return;
+    // Источники без страницы читают нули из своей же колонки - цикл без ветвлений внутри
+    static const uint8_t ZERO = 0;
+    const uint8_t* lo_src = lo ? lo : &ZERO;
+    const uint8_t* hi_src = hi ? hi : &ZERO;
+    uint8_t lo_step = lo ? 1 : 0, hi_step = hi ? 1 : 0;
+    uint8_t lo_shift = shift, hi_shift = hi ? (8 - shift) : 0;
+    auto data = [&](uint16_t i) -> uint8_t {
+        return (uint8_t)((lo_src[i * lo_step] << lo_shift) | (hi_src[i * hi_step] >> hi_shift)) & mask;
+    };
+    switch (mode) {
+        case REPLACE:  for (uint16_t i = 0; i < count; i++) dest[i] = (dest[i] & ~mask) | data(i); break;
+        case ERASE_BORDER:
+        case ADD_UP:   for (uint16_t i = 0; i < count; i++) dest[i] |= data(i); break;
+        case INV_AUTO: for (uint16_t i = 0; i < count; i++) dest[i] ^= data(i); break;
+        case ERASE:    for (uint16_t i = 0; i < count; i++) dest[i] &= ~data(i); break;
+    }
+}
+
+// --- Слои ---
+// Наложение слоя в одной формуле без ветвлений: acc = (acc & keep & ~(src & hole)) ^ (src & ink).
+// REPLACE: keep = 0, ink = ~0; ADD_UP: hole = ink = ~0; INV_AUTO: ink = ~0; ERASE: hole = ~0.
+struct LayerOp {
+    const uint8_t* src;
+    uint32_t keep, hole, ink;
+};
+
+// Сборка байт [from, from + count) кадра out из слоёв ops (снизу вверх). Середина - по 32 бита:
+// буферы слоёв и кадра выделены new[] и выровнены на 4, смещения у всех одинаковые.
+static void compose_span(uint8_t* out, const LayerOp* ops, uint8_t count_ops, uint16_t from, uint16_t count) {
+    uint16_t i = from, end = from + count;
+    auto compose_byte = [&](uint16_t k) {
+        uint8_t acc = 0;
+        for (uint8_t l = 0; l < count_ops; l++) {
+            uint8_t src = ops[l].src[k];
+            acc = (acc & ops[l].keep & ~(src & ops[l].hole)) ^ (src & ops[l].ink);
+        }
+        out[k] = acc;
+    };
+    for (; i < end && (i & 3); i++) compose_byte(i);
+    for (; i + 4 <= end; i += 4) {
+        uint32_t acc = 0;
+        for (uint8_t l = 0; l < count_ops; l++) {
+            uint32_t src;
+            memcpy(&src, __builtin_assume_aligned(ops[l].src + i, 4), 4);
+            acc = (acc & ops[l].keep & ~(src & ops[l].hole)) ^ (src & ops[l].ink);
+        }
+        memcpy(__builtin_assume_aligned(out + i, 4), &acc, 4);
+    }
+    for (; i < end; i++) compose_byte(i);
+}
+
+// --- Бегущий график ---
+// Строка области графика для значения value: maxY - верхняя строка, minY - нижняя, за диапазоном - край
+static int16_t chart_row(const ChartWidget &chart, float value) {
+    float span = chart.maxY - chart.minY;
+    int32_t level = (span > 0) ? (int32_t)lroundf((value - chart.minY) * (chart.h - 1) / span) : 0;
+    if (level < 0) level = 0;
+    if (level > chart.h - 1) level = chart.h - 1;
+    return chart.y + chart.h - 1 - level;
+}
+
+// Автомасштаб: диапазон с полями 10% расширяется сразу, а сужается, когда данные занимают меньше половины
+// (без этого график перерисовывался бы целиком почти на каждом отсчёте). Возвращает true, если диапазон сменился.
+static bool chart_autoscale(ChartWidget &chart) {
+    float lo = 0, hi = 0;
+    bool any = false;
+    for (uint16_t i = 0; i < chart.count; i++) {
+        float v = chart.samples[i];
+        if (std::isnan(v)) continue;
+        if (!any || v < lo) lo = v;
+        if (!any || v > hi) hi = v;
+        any = true;
+    }
+    if (!any) return false;
+    float span = hi - lo;
+    float range = chart.maxY - chart.minY;
+    bool outside = (lo < chart.minY || hi > chart.maxY || range <= 0);
+    if (!outside && span * 2 >= range) return false;
+    float margin = (span > 0) ? span * 0.1f : ((fabsf(hi) > 1) ? fabsf(hi) * 0.1f : 1);
+    chart.minY = lo - margin;
+    chart.maxY = hi + margin;
+    return true;
+}
+
+// --- Поворот холста ---
+// Транспонирование блока 8x8 бит (SWAR): бит b байта j <-> бит j байта b (байт j = биты 8j..8j+7).
+static inline uint64_t transpose8x8(uint64_t x) {
+    uint64_t t;
+    t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;  x ^= t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL; x ^= t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL; x ^= t ^ (t << 28);
+    return x;
+}
+
+// --- Форматирование чисел без snprintf ---
+static const uint32_t POW5_TABLE[] = { 1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125 };
+static const uint8_t MAX_FIXED_DECIMALS = 9;   // 53 бита мантиссы * 5^9 помещаются в 96 бит
+
+// Количество десятичных цифр числа (не меньше 1)
+static uint8_t count_digits(uint64_t value) {
+    uint8_t digits = 1;
+    while (value >= 10) { value /= 10; digits++; }
+    return digits;
+}
+
+// Округление mantissa * 2^exp2 * 10^decimals до целого (половина -> к чётному, как в printf).
+// Вычисление точное: P = mantissa * 5^decimals хранится в 96 битах (lo + hi), затем сдвиг на 2^(exp2 + decimals).
+// Возвращает false, если результат не помещается в uint64_t (тогда считает fixed_scale_wide).
+static bool fixed_scale(uint64_t mantissa, int16_t exp2, uint8_t decimals, uint64_t &scaled) {
+    uint64_t a = (mantissa & 0xFFFFFFFFULL) * POW5_TABLE[decimals];
+    uint64_t b = (mantissa >> 32) * POW5_TABLE[decimals];
+    uint64_t lo = a + (b << 32);
+    uint32_t hi = (uint32_t)(b >> 32) + (lo < a ? 1 : 0);
+
+    int16_t shift = exp2 + decimals;
+    if (shift >= 0) {
+        if (hi || shift >= 64 || (shift > 0 && (lo >> (64 - shift)))) return false;
+        scaled = lo << shift;
+        return true;
+    }
+
+    uint16_t k = -shift;
+    if (k >= 96) { scaled = 0; return true; } // P < 2^74, значит значение < 0.5
+
+    // Целая часть P >> k
+    uint64_t q;
+    if (k >= 64) {
+        q = hi >> (k - 64);
+    } else {
+        if (k < 32 && (hi >> k)) return false;
+        q = (lo >> k) | ((uint64_t)hi << (64 - k));
+    }
+
+    // Бит половины (k - 1) и "хвост" ниже него
+    uint16_t h = k - 1;
+    bool half = (h >= 64) ? ((hi >> (h - 64)) & 1) : ((lo >> h) & 1);
+    bool sticky;
+    if (h >= 64) sticky = lo || (hi & ((1UL << (h - 64)) - 1));
+    else sticky = (lo & ((1ULL << h) - 1)) != 0;
+
+    if (half && (sticky || (q & 1))) {
+        if (++q == 0) return false;
+    }
+    scaled = q;
+    return true;
+}
+
+// Медленный путь fixed_scale для значений от 2^64: точное длинное целое, слова по 32 бита (младшее первое).
+// Нужен для больших чисел с дробной частью (3.7e10f, 9 знаков) и для больших double (до 1.8e308).
+static const uint8_t WIDE_WORDS = 35;          // 2^1024 * 10^9 < 2^1054 -> 33 слова + перенос округления
+static const uint16_t WIDE_DIGITS = 35 * 10;   // 1120 бит < 10^338, цифры выводятся блоками по 9
+
+// Возвращает число занятых слов (не меньше 1).
+static uint8_t fixed_scale_wide(uint64_t mantissa, int16_t exp2, uint8_t decimals, uint32_t* words) {
+    memset(words, 0, WIDE_WORDS * sizeof(uint32_t));
+
+    // P = mantissa * 5^decimals, до 96 бит
+    uint64_t a = (mantissa & 0xFFFFFFFFULL) * POW5_TABLE[decimals];
+    uint64_t b = (mantissa >> 32) * POW5_TABLE[decimals];
+    uint64_t mid = (a >> 32) + (b & 0xFFFFFFFFULL);
+    words[0] = (uint32_t)a;
+    words[1] = (uint32_t)mid;
+    words[2] = (uint32_t)((mid >> 32) + (b >> 32));
+    uint8_t count = 3;
+
+    int16_t shift = exp2 + decimals;
+    if (shift >= 0) {
+        // Целое: P << shift. Идём сверху, чтобы не затереть ещё не сдвинутые слова
+        uint8_t word_shift = shift / 32, bit_shift = shift % 32;
+        for (int8_t i = count; i >= 0; i--) {
+            uint32_t w = words[i] << bit_shift;
+            if (bit_shift && i > 0) w |= words[i - 1] >> (32 - bit_shift);
+            words[i + word_shift] = w;
+        }
+        for (uint8_t i = 0; i < word_shift; i++) words[i] = 0;
+        count += word_shift + 1;
+    } else {
+        // P >> k с округлением половины к чётному (k < 96: иначе справился бы быстрый путь)
+        uint16_t k = -shift, h = k - 1;
+        bool half = (words[h / 32] >> (h % 32)) & 1;
+        bool sticky = (words[h / 32] & ((1UL << (h % 32)) - 1)) != 0;
+        for (uint8_t i = 0; i < h / 32; i++) sticky |= words[i] != 0;
+
+        uint8_t word_shift = k / 32, bit_shift = k % 32;
+        for (uint8_t i = 0; i < count; i++) {
+            uint32_t w = (i + word_shift < count) ? words[i + word_shift] >> bit_shift : 0;
+            if (bit_shift && i + word_shift + 1 < count) w |= words[i + word_shift + 1] << (32 - bit_shift);
+            words[i] = w;
+        }
+        if (half && (sticky || (words[0] & 1))) {
+            for (uint8_t i = 0; i <= count && ++words[i] == 0; i++) {}
+            count++;
+        }
+    }
+    while (count > 1 && words[count - 1] == 0) count--;
+    return count;
+}
+
+// inf/nan, как у printf: без нулей, дополняется пробелами слева.
+// Пишет не больше cap символов, возвращает полную длину.
+static uint16_t emit_special(char* dest, uint16_t cap, const char* word, bool negative, uint8_t min_width) {
+    uint8_t word_len = strlen(word);
+    uint8_t core = negative + word_len;
+    uint16_t len = (min_width > core) ? min_width : core;
+    uint8_t pad = len - core;
+    for (uint16_t pos = 0; pos < len && pos < cap; pos++) {
+        if (pos < pad) dest[pos] = ' ';
+        else if (negative && pos == pad) dest[pos] = '-';
+        else dest[pos] = word[pos - pad - negative];
+    }
+    return len;
+}
+
+// Раскладка "%0<min_width>.<decimals>f" по цифрам целого (reversed - младшая первая, count штук).
+// Пишет не больше cap символов, возвращает полную длину.
+static uint16_t emit_fixed_digits(char* dest, uint16_t cap, bool negative, const char* reversed, uint16_t count, uint8_t decimals, uint8_t min_width) {
+    // Минимум одна цифра целой части: 0.05 -> "0.05"
+    uint16_t digits = count;
+    if (digits < decimals + 1) digits = decimals + 1;
+    uint16_t core = negative + digits + (decimals ? 1 : 0);
+    uint16_t len = (min_width > core) ? min_width : core;
+
+    int16_t pos = len - 1;
+    for (uint16_t d = 0; d < digits; d++, pos--) {
+        if (decimals && d == decimals) {
+            if (pos < cap) dest[pos] = '.';
+            pos--;
+        }
+        if (pos < cap) dest[pos] = (d < count) ? reversed[d] : '0';
+    }
+    for (; pos >= negative; pos--) {
+        if (pos < cap) dest[pos] = '0';
+    }
+    if (negative && cap > 0) dest[0] = '-';
+    return len;
+}
+
+// Значения от 2^64 (после умножения на 10^decimals): цифры делением длинного целого на 10^9
+static uint16_t emit_fixed_wide(char* dest, uint16_t cap, bool negative, uint64_t mantissa, int16_t exp2, uint8_t decimals, uint8_t min_width) {
+    uint32_t words[WIDE_WORDS];
+    char reversed[WIDE_DIGITS];
+    uint8_t count = fixed_scale_wide(mantissa, exp2, decimals, words);
+
+    uint16_t digits = 0;
+    do {
+        uint32_t remainder = 0;
+        for (int8_t i = count - 1; i >= 0; i--) {
+            uint64_t current = ((uint64_t)remainder << 32) | words[i];
+            words[i] = (uint32_t)(current / 1000000000UL);
+            remainder = (uint32_t)(current % 1000000000UL);
+        }
+        while (count > 1 && words[count - 1] == 0) count--;
+        for (uint8_t d = 0; d < 9; d++) {
+            reversed[digits++] = '0' + remainder % 10;
+            remainder /= 10;
+        }
+    } while (count > 1 || words[0]);
+    while (digits > 1 && reversed[digits - 1] == '0') digits--; // Нули старшего блока
+
+    return emit_fixed_digits(dest, cap, negative, reversed, digits, decimals, min_width);
+}
+
+// Эквивалент "%0<min_width>.<decimals>f" для значения mantissa * 2^exp2.
+// Пишет не больше cap символов, возвращает полную длину.
+static uint16_t emit_fixed(char* dest, uint16_t cap, bool negative, uint64_t mantissa, int16_t exp2, uint8_t decimals, uint8_t min_width) {
+    if (decimals > MAX_FIXED_DECIMALS) decimals = MAX_FIXED_DECIMALS;
+
+    uint64_t scaled;
+    if (!fixed_scale(mantissa, exp2, decimals, scaled)) {
+        return emit_fixed_wide(dest, cap, negative, mantissa, exp2, decimals, min_width);
+    }
+
+    // Делим по 32 бита, когда значение уже помещается (на ESP32 деление uint64_t программное)
+    char reversed[20];
+    uint8_t count = 0;
+    do {
+        if (scaled <= 0xFFFFFFFFULL) {
+            uint32_t v = (uint32_t)scaled;
+            reversed[count++] = '0' + v % 10;
+            scaled = v / 10;
+        } else {
+            reversed[count++] = '0' + scaled % 10;
+            scaled /= 10;
+        }
+    } while (scaled);
+    return emit_fixed_digits(dest, cap, negative, reversed, count, decimals, min_width);
+}
+
 //****************************************************************************************
 //--- Конструктор и Деструктор ---
 //****************************************************************************************
 
-SavaOLED_ESP32::SavaOLED_ESP32(uint8_t width, uint8_t height, i2c_port_t port) {
+SavaOLED_ESP32::SavaOLED_ESP32(uint8_t width, uint8_t height, i2c_port_t port, uint8_t stripPages)
+    : SavaOLED_ESP32(width, height, port, stripPages, true) {}
+
+SavaOLED_ESP32::SavaOLED_ESP32(uint8_t width, uint8_t height, i2c_port_t port, uint8_t stripPages, bool frameBuffers) {
     _width = width;
     _height = height;
+    _panelWidth = width;
+    _panelHeight = height;
+    _canvasTurn = ROT_0;
 	_port = port;
 	_address = 0x3C; // <-- Инициализация адреса по умолчанию (критично)
 	_bufferSize = (_width * _height) / 8;
-    _buffer = std::make_unique<uint8_t[]>(_bufferSize);                                         //_buffer = new uint8_t[_bufferSize];
-    _tx_buffer = std::make_unique<uint8_t[]>(_bufferSize + 1);                                  //_tx_buffer = new uint8_t[_bufferSize + 1];
+    if (stripPages >= _height / 8) stripPages = 0; // полоса во весь экран - это обычный кадровый буфер
+    if (frameBuffers && stripPages) {
+        // Постраничный режим с самого начала: полный кадр не выделяется и не оставляет дыру в куче
+        _buffer = std::make_unique<uint8_t[]>(stripPages * _width);
+        _tx_buffer = std::make_unique<uint8_t[]>(_width + 1);
+    } else if (frameBuffers) {
+        _buffer = std::make_unique<uint8_t[]>(_bufferSize);                                     //_buffer = new uint8_t[_bufferSize];
+        _tx_buffer = std::make_unique<uint8_t[]>(_bufferSize + 1);                              //_tx_buffer = new uint8_t[_bufferSize + 1];
+    }
     _bus_handle = NULL;
     _dev_handle = NULL;
 	_currentFont = nullptr;
@@ -62,6 +577,7 @@ SavaOLED_ESP32::SavaOLED_ESP32(uint8_t width, uint8_t height, i2c_port_t port) {
 	_cursorY = 0;
     _drawMode = REPLACE;
 	_charSpacing = 1; 
+	_textScale = 1;
 	_cursorAlign = StrLeft;
     _cursorX2 = -1;
 	_scrollEnabled = false;
@@ -77,15 +593,91 @@ SavaOLED_ESP32::SavaOLED_ESP32(uint8_t width, uint8_t height, i2c_port_t port) {
 	_Buffer = false;
 	
     // --- Инициализация бинарного буфера ---
-    _lineBufferWidth = 1024; // -- изменено: увеличен буфер по ширине
-    _lineBufferHeightPages = 8; // -- изменено: увеличен буфер по высоте
-    _lineBuffer = std::make_unique<uint8_t[]>(_lineBufferWidth * _lineBufferHeightPages);       //_lineBuffer = new uint8_t[_lineBufferWidth * _lineBufferHeightPages];
-    _vertBuffer = std::make_unique<uint8_t[]>(VERT_BUF_SIZE);                                   //_vertBuffer = new uint8_t[VERT_BUF_SIZE]; 
+    _lineBufferHeightPages = LINE_BUFFER_PAGES; // -- изменено: увеличен буфер по высоте
+    _lineOrigin = 0;
+    if (stripPages) {
+        _lineBufferWidth = 0; // В pageMode выделяется при первом drawPrint() шириной с экран
+    } else {
+        _lineBufferWidth = LINE_BUFFER_WIDTH; // -- изменено: увеличен буфер по ширине
+        _lineBuffer = std::make_unique<uint8_t[]>(_lineBufferWidth * LINE_BUFFER_PAGES);   //_lineBuffer = new uint8_t[_lineBufferWidth * _lineBufferHeightPages];
+    }
+    // _vertBuffer выделяется при первом drawPrintVert()
     _vertBufferHeight = 0;
+    _vertBufferWidth = 0;
+    _vertTapePages = 0;
+    _vertSignature = 0;
+    _boxLineCount = 0;
+    _boxFirstLine = 0;
+    _boxSignature = 0;
+    _boxX = 0;
+    _boxY = 0;
+    _boxW = width;
+    _boxH = height;
+    _boxAlign = StrLeft;
+    _boxLineSpacing = 1;
+    _boxWordWrap = true;
     _currentLineWidth = 0;
+    _lineShift = 0;
+    _glyphPoolSize = 0;
+    _glyphPoolUsed = 0;
+    _glyphCacheHits = 0;
+    _glyphCacheMisses = 0;
     _segmentCount = 0;
     _textBufferPos = 0;
     _lineChanged = false;
+    _lineMixedModes = false;
+    _listCapacity = 0;
+    _listTextSize = 0;
+    _listCount = 0;
+    _listPrevCount = 0;
+    _listSegmentCount = 0;
+    _listTextUsed = 0;
+    _listRedrawn = 0;
+    _listRecording = false;
+    _listValid = false;
+    _listDirtyX0 = _listDirtyY0 = _listDirtyX1 = _listDirtyY1 = 0;
+    _stripPages = stripPages;
+    _bufferPage0 = 0;
+    _bufferPages = stripPages ? stripPages : (_height / 8);
+    _resetClip();
+    _renderTaskHandle = nullptr;
+    _renderMutex = nullptr;
+    _renderDone = nullptr;
+    _renderStop = false;
+    _listOverflow = false;
+    _frameItems = 0;
+    _frameSegments = 0;
+    _frameText = 0;
+    _renderFrames = 0;
+    _renderDropped = 0;
+    _queueMask = 0;
+    _queueHead = 0;
+    _queueTail = 0;
+    _queueDropped = 0;
+    _queueWidgets = 0;
+    _queueCoalesced = 0;
+    _queuePeak = 0;
+    _rasterTaskHandle = nullptr;
+    _rasterDone = nullptr;
+    _rasterStop = false;
+    _rasterSplit = 0;
+    _rasterJobItems = nullptr;
+    _rasterJobSegments = nullptr;
+    _rasterJobRegions = nullptr;
+    _rasterJobCount = 0;
+    _rasterJobRegionCount = 0;
+    _rasterJobClear = false;
+    _rasterJobDrawn = 0;
+    _target = _buffer.get();
+    _canvasTarget = nullptr;
+    _screenWidth = _screenHeight = 0;
+    _screenPage0 = _screenPages = 0;
+    _layerCount = 0;
+    _layerDirty = 0;
+    _composedPages = 0;
+    _overlayBytes = _overlayUsed = 0;
+    _overlayMax = _overlayDepth = 0;
+    _overlayOverflows = 0;
 
     _inverted = false;
     _contrast = 0xCF; // совпадает с init sequence
@@ -93,6 +685,13 @@ SavaOLED_ESP32::SavaOLED_ESP32(uint8_t width, uint8_t height, i2c_port_t port) {
 }
 
 SavaOLED_ESP32::~SavaOLED_ESP32() {
+    // Задача рендера обращается к объекту - останавливаем её до освобождения ресурсов
+    renderStop();
+    rasterCores(1);
+    if (_renderMutex) vSemaphoreDelete(_renderMutex);
+    if (_renderDone) vSemaphoreDelete(_renderDone);
+    if (_rasterDone) vSemaphoreDelete(_rasterDone);
+
     // Корректное удаление I2C-ресурсов по реальному API (i2c_master.h)
     if (_dev_handle) {
         // i2c_master_bus_rm_device принимает дескриптор устройства
@@ -187,7 +786,7 @@ void SavaOLED_ESP32::init(uint32_t freq, int8_t _sda, int8_t _scl) {
     // ============================================================
     _sendCommands(ssd1306_init_sequence, sizeof(ssd1306_init_sequence));
 
-    uint8_t mux_ratio_cmd[] = {OLED_SET_MUX_RATIO, (uint8_t)(_height - 1)};
+    uint8_t mux_ratio_cmd[] = {OLED_SET_MUX_RATIO, (uint8_t)(_panelHeight - 1)};
     _sendCommands(mux_ratio_cmd, sizeof(mux_ratio_cmd));
 
     clear();
@@ -197,8 +796,8 @@ void SavaOLED_ESP32::init(uint32_t freq, int8_t _sda, int8_t _scl) {
     // Успех!
     // ============================================================
     _initialized = true;
-    OLED_LOG("OLED initialized successfully (%dx%d @ %lu Hz)", _width, _height, freq);
-    Serial.printf("[SavaOLED] Display ready: %dx%d, I2C @ %lu Hz\n", _width, _height, freq);
+    OLED_LOG("OLED initialized successfully (%dx%d @ %lu Hz)", _panelWidth, _panelHeight, freq);
+    Serial.printf("[SavaOLED] Display ready: %dx%d, I2C @ %lu Hz\n", _panelWidth, _panelHeight, freq);
 }
 
 void SavaOLED_ESP32::setAddress(uint8_t address){
@@ -218,6 +817,12 @@ void SavaOLED_ESP32::charSpacing(uint8_t spacing) {
     _charSpacing = spacing; 
 }
 
+void SavaOLED_ESP32::textScale(uint8_t scale) {
+    if (scale < 1) scale = 1;
+    if (scale > 4) scale = 4;
+    _textScale = scale;
+}
+
 void SavaOLED_ESP32::scrollSpeed(uint8_t speed, bool loop) {
     if (speed < 1) speed = 1;
     if (speed > 15) speed = 15;
@@ -240,6 +845,36 @@ void SavaOLED_ESP32::setBuffer(bool enabled) {
     _Buffer = enabled; 
 }
 
+void SavaOLED_ESP32::glyphCache(uint16_t maxBytes) {
+    _glyphCacheHits = 0;
+    _glyphCacheMisses = 0;
+    _glyphPoolUsed = 0;
+    uint16_t slots_size = GLYPH_CACHE_SLOTS * sizeof(GlyphCacheEntry);
+    if (maxBytes <= slots_size) {
+        if (maxBytes > 0) {
+            OLED_WARN("glyphCache: %u bytes is too small (table alone takes %u), cache disabled", maxBytes, slots_size);
+        }
+        _glyphSlots.reset();
+        _glyphPool.reset();
+        _glyphPoolSize = 0;
+        return;
+    }
+    _glyphPoolSize = maxBytes - slots_size;
+    _glyphSlots = std::make_unique<GlyphCacheEntry[]>(GLYPH_CACHE_SLOTS);
+    _glyphPool = std::make_unique<uint8_t[]>(_glyphPoolSize);
+    for (uint8_t i = 0; i < GLYPH_CACHE_SLOTS; i++) _glyphSlots[i].fontPtr = nullptr;
+    _lineChanged = true;
+    if (_rasterHelper) _rasterHelper->glyphCache(maxBytes); // второе ядро рисует строки своим кэшем
+}
+
+uint32_t SavaOLED_ESP32::getGlyphCacheHits() const {
+    return _glyphCacheHits;
+}
+
+uint32_t SavaOLED_ESP32::getGlyphCacheMisses() const {
+    return _glyphCacheMisses;
+}
+
 void SavaOLED_ESP32::contrast(uint8_t value) {
     uint8_t cmds[2] = { OLED_SET_CONTRAST, value };
     _sendCommands(cmds, sizeof(cmds));
@@ -279,6 +914,48 @@ void SavaOLED_ESP32::rotation(bool rotate180) {
     }
 }
 
+void SavaOLED_ESP32::canvasRotation(uint8_t turn) {
+    if (turn != ROT_0 && turn != ROT_90 && turn != ROT_270) {
+        OLED_WARN("canvasRotation: unsupported turn %u", turn);
+        return;
+    }
+    if (turn == _canvasTurn) return;
+    if (_stripPages) {
+        OLED_ERROR("canvasRotation: not available in pageMode");
+        return;
+    }
+    if (_canvasTarget) {
+        OLED_ERROR("canvasRotation: call canvasEnd first");
+        return;
+    }
+    if (_layerCount) {
+        OLED_ERROR("canvasRotation: not available with layers (call layers(0) first)");
+        return;
+    }
+    if (turn != ROT_0 && ((_panelWidth % 8) || (_panelHeight % 8))) {
+        OLED_ERROR("canvasRotation: panel %ux%u is not a multiple of 8", _panelWidth, _panelHeight);
+        return;
+    }
+    _canvasTurn = turn;
+    _overlayDepth = 0;   // Раскладка кадра меняется - сохранённые области недействительны
+    _overlayUsed = 0;
+    bool portrait = (turn != ROT_0);
+    _width = portrait ? _panelHeight : _panelWidth;
+    _height = portrait ? _panelWidth : _panelHeight;
+    if (portrait && !_rotBuffer) _rotBuffer = std::make_unique<uint8_t[]>(_bufferSize);
+    if (!portrait) _rotBuffer.reset();
+    clear(); // старое содержимое буфера в другой раскладке
+    _bufferPages = _height / 8;
+    if (_rasterHelper) {
+        // Буфер второго ядра - на весь кадр, меняется только раскладка
+        _rasterHelper->_width = _width;
+        _rasterHelper->_height = _height;
+    }
+    _resetClip();
+    _listValid = false;
+    _lineChanged = true;
+}
+
 //****************************************************************************************
 //--- Публичные функции "Управление курсором" ---
 //****************************************************************************************
@@ -309,13 +986,51 @@ uint16_t SavaOLED_ESP32::getTextWidth() const {
 
 uint16_t SavaOLED_ESP32::getTextHeight() const {
     if (_segmentCount == 0 || !_currentFont) return 0;
-    return _currentFont->height;
+    return _currentFont->height * fit_scale(_currentFont, _textScale, LINE_BUFFER_PAGES * 8); // как в drawPrint()
+}
+
+uint16_t SavaOLED_ESP32::measureText(const char* text, const savaFont &font, uint8_t spacing, uint8_t scale) const {
+    if (!text) return 0;
+    return measureText(text, strlen(text), font, spacing, scale);
+}
+
+uint16_t SavaOLED_ESP32::measureText(const char* text, size_t len, const savaFont &font, uint8_t spacing, uint8_t scale) const {
+    if (!text) return 0;
+    if (len > 0xFFFF) len = 0xFFFF;
+    uint32_t pen = _measureRun(text, len, &font, spacing, scale);
+    if (pen == 0) return 0;
+    pen -= spacing;
+    return (pen > 0xFFFF) ? 0xFFFF : pen;
+}
+
+uint16_t SavaOLED_ESP32::measureText(const TextSegment* segments, uint8_t count, uint8_t spacing) const {
+    if (!segments) return 0;
+    uint32_t pen = 0;
+    for (uint8_t s = 0; s < count; s++) {
+        const TextSegment &segment = segments[s];
+        pen += _measureRun(segment.text, segment.length, segment.fontPtr, spacing, segment.scale);
+    }
+    if (pen == 0) return 0;
+    pen -= spacing;
+    return (pen > 0xFFFF) ? 0xFFFF : pen;
+}
+
+uint16_t SavaOLED_ESP32::measureText() const {
+    return measureText(_segments, _segmentCount, _charSpacing);
 }
 
 uint16_t SavaOLED_ESP32::getScopeCursor() const {
     return (_cursorX2 >= 0) ? _cursorX2 : (_width - 1);
 }
 
+uint8_t SavaOLED_ESP32::getWidth() const {
+    return _width;
+}
+
+uint8_t SavaOLED_ESP32::getHeight() const {
+    return _height;
+}
+
 bool SavaOLED_ESP32::isReady() const {
     return _initialized && (_dev_handle != NULL);
 }
@@ -326,61 +1041,46 @@ bool SavaOLED_ESP32::isReady() const {
 // --- Основная функция print для const char* ---
 //****************************************************************************************
 void SavaOLED_ESP32::print(const char* text) {
+    size_t text_len = strlen(text);
+    char* dest = _reserveSegment(text_len);
+    if (!dest) return;
+
+    // Безопасное копирование текста в общий буфер
+    memcpy(dest, text, text_len);
+    _commitSegment(text_len);
+}
+
+void SavaOLED_ESP32::printRef(const char* text, size_t len) {
+    if (!text) return;
     if (_segmentCount >= MAX_SEGMENTS) {
         OLED_ERROR("Segment overflow! Max %d segments per line", MAX_SEGMENTS);
         return;
     }
+    if (len > 0xFFFF) len = 0xFFFF;
+    // Без копирования: сегмент просто ссылается на внешнюю строку
+    _addSegment(text, len);
+}
 
-    size_t text_len = strlen(text);
-    if (_textBufferPos + text_len + 1 > TEXT_BUFFER_SIZE) {
-        OLED_ERROR("Text buffer overflow! Pos: %zu, Need: %zu, Max: %zu",
-                   _textBufferPos, text_len, TEXT_BUFFER_SIZE);
-        return;
-    }
-
-    // Безопасное копирование текста в общий буфер
-    size_t available_space = TEXT_BUFFER_SIZE - _textBufferPos - 1;
-    strncpy(&_textBuffer[_textBufferPos], text, available_space);
-    _textBuffer[TEXT_BUFFER_SIZE - 1] = '\0';
-
-    // Создаем и заполняем новый сегмент
-    _segments[_segmentCount].text = &_textBuffer[_textBufferPos];
-    _segments[_segmentCount].fontPtr = _currentFont;
-    //_segments[_segmentCount].drawMode = _drawMode;
+void SavaOLED_ESP32::printRef(const char* text) {
+    if (!text) return;
+    printRef(text, strlen(text));
+}
 
-    // Сдвигаем позицию в буфере и увеличиваем счетчик сегментов
-    _textBufferPos += text_len; // Сдвигаем указатель на длину скопированного текста
-    _textBuffer[_textBufferPos] = '\0'; // Ставим нуль-терминатор
-    _textBufferPos++; // Переходим на следующую позицию
-    _segmentCount++;
+// На ESP32 flash отображена в адресное пространство, F("...") читается напрямую
+void SavaOLED_ESP32::print(const __FlashStringHelper* text) { printRef(reinterpret_cast<const char*>(text)); }
 
-    _lineChanged = true;
-}
 void SavaOLED_ESP32::print(int32_t value, uint8_t min_digits) {
-    char buffer[22] = {0};
-    if (min_digits > 0) {
-        char format[8] = {0};
-        //   'ld' теперь просто символы в конце строки
-        snprintf(format, sizeof(format), "%%0%dld", min_digits); 
-        snprintf(buffer, sizeof(buffer), format, value);
-    } else {
-        snprintf(buffer, sizeof(buffer), "%ld", value);
-    }
-    print(buffer);
-	//Serial.println(buffer);
+    // Модуль через unsigned, чтобы корректно обработать INT32_MIN
+    uint32_t magnitude = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+    char* dest = _reserveSegment(0);
+    if (!dest) return;
+    _commitNumber(_emitInteger(dest, _freeTextSpace(), value < 0, magnitude, min_digits), 21); // 21 — как у прежнего буфера snprintf[22]
 }
 
 void SavaOLED_ESP32::print(uint32_t value, uint8_t min_digits) {
-    char buffer[22] = {0};
-    if (min_digits > 0) {
-        char format[8] = {0};
-        //   'lu' теперь просто символы в конце строки
-        snprintf(format, sizeof(format), "%%0%dlu", min_digits);
-        snprintf(buffer, sizeof(buffer), format, value);
-    } else {
-        snprintf(buffer, sizeof(buffer), "%lu", value);
-    }
-    print(buffer);
+    char* dest = _reserveSegment(0);
+    if (!dest) return;
+    _commitNumber(_emitInteger(dest, _freeTextSpace(), false, value, min_digits), 21);
 }
 
 // Перегрузки для меньших типов просто вызывают основные реализации
@@ -391,31 +1091,15 @@ void SavaOLED_ESP32::print(uint8_t value, uint8_t min_digits) { print((uint32_t)
 void SavaOLED_ESP32::print(uint16_t value, uint8_t min_digits) { print((uint32_t)value, min_digits); }
 
 void SavaOLED_ESP32::print(double value, uint8_t decimalPlaces, uint8_t min_width) {
-    char buffer[32] = {0};
-    char format[12] = {0};
-
-    // Если задана минимальная ширина, создаем сложный формат
-    if (min_width > 0) {
-        // Создаем строку формата, например "%08.2f"
-        // %0 - дополнять нулями
-        // 8  - общая ширина
-        // .2 - два знака после запятой
-        // f  - тип float/double
-        snprintf(format, sizeof(format), "%%0%d.%df", min_width, decimalPlaces);
-    } 
-    // Иначе создаем простой формат только с указанием точности
-    else {
-        snprintf(format, sizeof(format), "%%.%df", decimalPlaces);
-    }
-    
-    // Применяем созданный формат для преобразования числа в строку
-    snprintf(buffer, sizeof(buffer), format, value);
-    print(buffer);
+    char* dest = _reserveSegment(0);
+    if (!dest) return;
+    _commitNumber(_emitDouble(dest, _freeTextSpace(), value, decimalPlaces, min_width), 31); // 31 — как у прежнего буфера snprintf[32]
 }
 
-// Перегрузка для float просто вызывает реализацию для double
 void SavaOLED_ESP32::print(float value, uint8_t decimalPlaces, uint8_t min_width) {
-    print((double)value, decimalPlaces, min_width);
+    char* dest = _reserveSegment(0);
+    if (!dest) return;
+    _commitNumber(_emitFloat(dest, _freeTextSpace(), value, decimalPlaces, min_width), 31);
 }
 
 void SavaOLED_ESP32::print(const String &s) { print(s.c_str()); }
@@ -426,6 +1110,7 @@ void SavaOLED_ESP32::print(const String &s) { print(s.c_str()); }
 
 void SavaOLED_ESP32::drawPrint() {
     if (_segmentCount == 0 && !_scrollEnabled) return;
+    if (_listRecording) { _listAddText(); return; }
 
     // --- Шаг 1: Перерисовка во временный буфер (только если текст изменился) ---
     if (_lineChanged) {
@@ -434,21 +1119,61 @@ void SavaOLED_ESP32::drawPrint() {
         for (uint8_t s = 0; s < _segmentCount; ++s) {
             const auto& segment = _segments[s];
             if (segment.fontPtr) {
-                uint8_t pages_per_char = (segment.fontPtr->height + 7) / 8;
+                uint8_t pages_per_char = (segment.fontPtr->height * segment.scale + 7) / 8;
+                if (pages_per_char > LINE_BUFFER_PAGES) pages_per_char = LINE_BUFFER_PAGES;
                 if (pages_per_char > max_line_pages) {
                     max_line_pages = pages_per_char;
                 }
             }
         }
+        // Строка с y, не кратным 8, рисуется в буфер сразу сдвинутой (на страницу выше),
+        // чтобы шаг 3 копировал байты без побитовых сдвигов. Строке во всю высоту буфера сдвигаться некуда.
+        _lineShift = (max_line_pages < LINE_BUFFER_PAGES) ? (_cursorY & 7) : 0;
+
         // Сохраняем высоту буфера
-        _lineBufferHeightPages = max_line_pages;
+        _lineBufferHeightPages = max_line_pages + (_lineShift ? 1 : 0);
+
+        // 1.2 Видимое окно строки. Без прокрутки положение строки на экране известно до растеризации
+        // (для StrCenter/StrRight ширина берётся из таблицы ширин шрифта - measureText()),
+        // поэтому рисуются и очищаются только колонки, попадающие на экран.
+        int32_t clip_left = 0;
+        int32_t clip_right = LINE_BUFFER_WIDTH;
+        uint16_t measured_width = 0;
+        if (_cursorAlign == StrCenter || _cursorAlign == StrRight) measured_width = measureText();
+        bool clipped = (_cursorAlign != StrScroll && measured_width < LINE_BUFFER_WIDTH); // строка длиннее буфера - без отсечения
+        if (clipped) {
+            int16_t region_width = (_cursorX2 > 0) ? _cursorX2 : (_width - _cursorX);
+            int32_t align_shift = 0; // сдвиг начала строки относительно _cursorX (как в шаге 2)
+            if (_cursorAlign == StrCenter) align_shift = (region_width / 2) - (measured_width / 2);
+            else if (_cursorAlign == StrRight) align_shift = region_width - measured_width;
+            int32_t window_left = ((_cursorX < 0) ? -_cursorX : 0) - align_shift;
+            int32_t window_right = ((region_width < _width - _cursorX) ? region_width : (_width - _cursorX)) - align_shift;
+            if (window_left > clip_left) clip_left = window_left;
+            if (window_right < clip_right) clip_right = window_right;
+            if (clip_right < 0) clip_right = 0;
+            if (clip_left > clip_right) clip_left = clip_right; // строка целиком за пределами экрана
+        }
+
+        // 1.3 Буфер строки. В pageMode он шириной с экран и хранит только видимое окно строки (не шире экрана),
+        // начиная с колонки _lineOrigin. Бегущей строке и строке длиннее LINE_BUFFER_WIDTH нужен весь буфер -
+        // тогда он расширяется до полного и остаётся таким
+        uint16_t need_width = (_stripPages && clipped) ? _width : LINE_BUFFER_WIDTH;
+        if (!_lineBuffer || _lineBufferWidth < need_width) {
+            _lineBuffer.reset();
+            _lineBuffer = std::make_unique<uint8_t[]>(need_width * LINE_BUFFER_PAGES);
+            _lineBufferWidth = need_width;
+        }
+        _lineOrigin = (_lineBufferWidth < LINE_BUFFER_WIDTH) ? clip_left : 0;
+        const int32_t line_end = _lineOrigin + _lineBufferWidth; // первая колонка строки за буфером
 
-        // 1.2 Очищаем буфер
-        memset(_lineBuffer.get(), 0, _lineBufferWidth * max_line_pages);
+        // 1.4 Очищаем только используемые колонки буфера
+        for (uint8_t p = 0; p < _lineBufferHeightPages; p++) {
+            memset(_lineBuffer.get() + p * _lineBufferWidth + (clip_left - _lineOrigin), 0, clip_right - clip_left);
+        }
         
         int16_t current_x = 0;
 
-        // 1.3 Рисуем сегменты
+        // 1.5 Рисуем сегменты
         for (uint8_t s = 0; s < _segmentCount; ++s) {
             const auto& segment = _segments[s];
             const savaFont* fontPtr = segment.fontPtr;
@@ -457,16 +1182,16 @@ void SavaOLED_ESP32::drawPrint() {
             if (!fontPtr || !text) continue;
             uint8_t pages_per_char = (fontPtr->height + 7) / 8;
 
-            int i = 0;
-            while (text[i] != '\0' && current_x < _lineBufferWidth) {
+            // Масштаб: высота после растяжения не должна превышать буфер строки (64 пикселя)
+            uint8_t scale = fit_scale(fontPtr, segment.scale, LINE_BUFFER_PAGES * 8);
+            uint8_t glyph_height = (fontPtr->height < 32) ? fontPtr->height : 32;
+            uint8_t scaled_pages = (glyph_height * scale + 7) / 8;
+            uint32_t height_mask = (glyph_height < 32) ? ((1UL << glyph_height) - 1) : 0xFFFFFFFFUL;
+
+            uint16_t i = 0;
+            while (i < segment.length && current_x < LINE_BUFFER_WIDTH) {
                 // Декодируем UTF-8 в CP1251 или ASCII
-                uint16_t char_code = (uint8_t)text[i];
-                if (char_code < 128) { 
-                    i++; 
-                } else { 
-                    char_code = utf8_to_cp1251((uint8_t)text[i], (uint8_t)text[i+1]); 
-                    i += 2; 
-                }
+                uint32_t char_code = utf8_next(text, segment.length, i);
                 
                 // Получаем индекс символа (0..159)
                 uint16_t index = _getCharIndex(fontPtr, char_code);
@@ -474,35 +1199,101 @@ void SavaOLED_ESP32::drawPrint() {
                 if (index != 0xFFFF) {
                     // --- Читаем через Offsets ---
                     // 1. Находим начало данных символа
-                    uint16_t glyph_data_start = fontPtr->offsets[index];
+                    const uint8_t* char_ptr = &fontPtr->data[fontPtr->offsets[index]];
                     
-                    // 2. Первый байт - это ШИРИНА символа
-                    uint8_t char_width = fontPtr->data[glyph_data_start];
+                    // 2. Первый байт - это ШИРИНА символа (старший бит - флаг сжатия)
+                    uint16_t char_width = glyph_width(char_ptr);
                     
                     // 3. Указатель на саму графику (пропускаем байт ширины)
-                    const uint8_t* glyph_pixels = &fontPtr->data[glyph_data_start + 1];
-
-                    // 4. Отрисовка столбиков
-                    for (uint8_t col = 0; col < char_width; col++) {
-                        if (current_x + col >= _lineBufferWidth) break;
-                        
-                        // Копируем байты по вертикали (страницы)
-                        // Данные лежат: [Width] [Page0_Row] [Page1_Row] ...
-                        // Чтобы взять байт страницы P для колонки C:
-                        // Адрес = (P * char_width) + col
-                        for (uint8_t p = 0; p < pages_per_char; p++) {
-                            uint32_t dest_idx = (current_x + col) + (p * _lineBufferWidth);
+                    const uint8_t* glyph_pixels = char_ptr + 1;
+
+                    uint8_t glyph_pages = (scale > 1) ? scaled_pages : pages_per_char; // страниц, занятых символом в буфере
+                    const uint8_t* shifted = nullptr;
+                    bool visible = (current_x + char_width * scale > clip_left) && (current_x < clip_right);
+                    if (visible && _lineShift && scale == 1) {
+                        shifted = _cachedShiftedGlyph(fontPtr, index, char_ptr, pages_per_char, _lineShift);
+                    }
+
+                    if (!visible) {
+                        // Символ вне видимого окна: только сдвигаем курсор
+                        char_width *= scale;
+                    } else if (shifted) {
+                        // 4. Символ из кэша, уже сдвинутый на _lineShift: копируем pages_per_char + 1 строк
+                        int32_t copy_from = (current_x > _lineOrigin) ? current_x : _lineOrigin;
+                        int32_t copy_to = (current_x + char_width < line_end) ? (current_x + char_width) : line_end;
+                        for (uint8_t p = 0; p <= pages_per_char && copy_from < copy_to; p++) {
+                            memcpy(_lineBuffer.get() + p * _lineBufferWidth + (copy_from - _lineOrigin),
+                                   shifted + p * char_width + (copy_from - current_x), copy_to - copy_from);
+                        }
+                    } else if (scale > 1) {
+                        // 4. Масштаб: колонка растягивается по вертикали таблицами и повторяется scale раз
+                        uint32_t cols[128];
+                        glyph_columns(char_ptr, pages_per_char, cols);
+                        for (uint8_t col = 0; col < char_width; col++) {
+                            uint64_t scaled = spread_column(cols[col] & height_mask, glyph_height, scale);
+                            for (uint8_t k = 0; k < scale; k++) {
+                                int32_t x = current_x + col * scale + k;
+                                if (x >= line_end) break;
+                                if (x < _lineOrigin) continue;
+                                for (uint8_t p = 0; p < scaled_pages; p++) {
+                                    _lineBuffer.get()[(x - _lineOrigin) + p * _lineBufferWidth] = (uint8_t)(scaled >> (p * 8));
+                                }
+                            }
+                        }
+                        char_width *= scale;
+                    } else if (!(*char_ptr & FONT_RLE_FLAG)) {
+                        // 4. Отрисовка столбиков (несжатый символ - быстрый путь)
+                        for (uint8_t col = 0; col < char_width; col++) {
+                            int32_t x = current_x + col;
+                            if (x >= line_end) break;
+                            if (x < _lineOrigin) continue;
                             
-                            // Защита от выхода за пределы вертикального буфера
-                            if (dest_idx < (uint32_t)(_lineBufferWidth * max_line_pages)) {
-                                _lineBuffer.get()[dest_idx] = glyph_pixels[p * char_width + col];
+                            // Копируем байты по вертикали (страницы)
+                            // Данные лежат: [Width] [Page0_Row] [Page1_Row] ...
+                            // Чтобы взять байт страницы P для колонки C:
+                            // Адрес = (P * char_width) + col
+                            for (uint8_t p = 0; p < pages_per_char; p++) {
+                                uint32_t dest_idx = (x - _lineOrigin) + (p * _lineBufferWidth);
+                                
+                                // Защита от выхода за пределы вертикального буфера
+                                if (dest_idx < (uint32_t)(_lineBufferWidth * max_line_pages)) {
+                                    _lineBuffer.get()[dest_idx] = glyph_pixels[p * char_width + col];
+                                }
                             }
                         }
+                    } else {
+                        // 4. Сжатый символ: распаковка на лету в порядке хранения (страница за страницей).
+                        // Страницы ниже буфера строки не распаковываются (как и в несжатом пути)
+                        RleStream stream(glyph_pixels);
+                        uint8_t rows = (pages_per_char < max_line_pages) ? pages_per_char : max_line_pages;
+                        for (uint8_t p = 0; p < rows; p++) {
+                            uint8_t* dest_row = _lineBuffer.get() + p * _lineBufferWidth;
+                            for (uint8_t col = 0; col < char_width; col++) {
+                                uint8_t data_byte = stream.next();
+                                int32_t x = current_x + col;
+                                if (x >= _lineOrigin && x < line_end) dest_row[x - _lineOrigin] = data_byte;
+                            }
+                        }
+                    }
+                    if (visible && !shifted && _lineShift) {
+                        // Кэш выключен или символ в него не помещается: сдвигаем колонки символа на месте
+                        int32_t shift_from = (current_x > _lineOrigin) ? current_x : _lineOrigin;
+                        int32_t shift_to = (current_x + char_width < line_end) ? (current_x + char_width) : line_end;
+                        if (shift_from < shift_to) {
+                            shift_columns(_lineBuffer.get(), _lineBufferWidth, shift_from - _lineOrigin, shift_to - shift_from, glyph_pages, _lineShift);
+                        }
                     }
                     // Сдвигаем курсор на ширину символа + интервал
                     current_x += char_width + _charSpacing;
                 }
             }
+            _segmentEnd[s] = current_x;
+        }
+
+        // Режимы отрисовки сегментов: при одинаковых шаг 3 не ищет сегмент для каждой колонки
+        _lineMixedModes = false;
+        for (uint8_t s = 1; s < _segmentCount; ++s) {
+            if (_segments[s].drawMode != _segments[0].drawMode) _lineMixedModes = true;
         }
         
         // Корректируем итоговую ширину строки (убираем последний интервал)
@@ -543,9 +1334,50 @@ void SavaOLED_ESP32::drawPrint() {
 
     // --- Шаг 3: Копирование "окна" из _lineBuffer в _buffer ---
     const uint8_t pages = _height / 8;
+    int16_t y_page_start = _cursorY >> 3; // страница экрана с округлением вниз (верно и для y < 0)
+    uint8_t y_offset = _cursorY & 7;
+    bool pre_shifted = (y_offset == 0) || (_lineShift != 0); // строка в буфере уже выровнена по страницам экрана
+
+    // Защитные маски (Cover Mask) - считаются один раз на строку.
+    // Они показывают, какие биты в байте дисплея МЫ ИМЕЕМ ПРАВО трогать.
+    // 1 = это зона нашего символа (здесь мы пишем данные или стираем фон).
+    // 0 = это зона выше/ниже символа в этом байте (её трогать нельзя).
+    uint8_t cover[LINE_BUFFER_PAGES + 1];
+    for (uint8_t p = 0; p < _lineBufferHeightPages; p++) cover[p] = 0xFF;
+    if (pre_shifted && y_offset > 0) {
+        cover[0] = 0xFF << y_offset;
+        cover[_lineBufferHeightPages - 1] = 0xFF >> (8 - y_offset);
+    }
+    uint8_t cover_top = 0xFF << y_offset;
+    uint8_t cover_bottom = (y_offset > 0) ? (0xFF >> (8 - y_offset)) : 0;
+
+    // Окно отсечения по Y (список отображения перерисовывает только изменённую область) - в тех же масках
+    int16_t clip_y1 = (_clipY1 < pages * 8) ? _clipY1 : (pages * 8);
+    uint8_t cover_top_at[LINE_BUFFER_PAGES];
+    uint8_t cover_bottom_at[LINE_BUFFER_PAGES];
+    for (int16_t p = 0; p < _lineBufferHeightPages; p++) {
+        if (pre_shifted) {
+            cover[p] &= page_rows_mask(y_page_start + p, _clipY0, clip_y1);
+        } else {
+            cover_top_at[p] = cover_top & page_rows_mask(y_page_start + p, _clipY0, clip_y1);
+            cover_bottom_at[p] = cover_bottom & page_rows_mask(y_page_start + p + 1, _clipY0, clip_y1);
+        }
+    }
+
+    // Режим отрисовки: у каждого сегмента свой (задаётся drawMode() до print), строка переносится за один проход
+    uint8_t mode = (_segmentCount > 0) ? _segments[0].drawMode : _drawMode;
+    uint8_t mode_segment = 0;
+    int32_t prev_source_x = -1;
+
+    // Строки буфера, попадающие на экран (в окно отсечения) по вертикали
+    int16_t p_first = (_clipY0 >> 3) - y_page_start;
+    if (p_first < 0) p_first = 0;
+    int16_t p_last = ((clip_y1 + 7) >> 3) - y_page_start; // не включительно
+    if (p_last > _lineBufferHeightPages) p_last = _lineBufferHeightPages;
+
     for (int16_t i = 0; i < region_width; i++) {
         int16_t screen_x = _cursorX + i;
-        if (screen_x < 0 || screen_x >= _width) continue; // защита от выхода за границы
+        if (screen_x < _clipX0 || screen_x >= _clipX1) continue; // защита от выхода за границы
         int32_t source_x;
 
         if (scrolling && _scrollLoop && loop_width > 0) {
@@ -556,58 +1388,77 @@ void SavaOLED_ESP32::drawPrint() {
             source_x = signed_offset + i - (startX_on_screen - _cursorX);
         }
 //Serial.println(endX_on_screen);
-     if (source_x >= 0 && source_x < _currentLineWidth) {
-            uint8_t y_page_start = _cursorY / 8;
-            uint8_t y_offset = _cursorY % 8;
-            
-            // ---  Простой цикл по всем страницам отрисованной строки
+     if (source_x >= _lineOrigin && source_x < _currentLineWidth && source_x < _lineOrigin + _lineBufferWidth) { // строка длиннее буфера обрезается
+            const uint8_t* source_col = _lineBuffer.get() + (source_x - _lineOrigin);
+
+            if (_lineMixedModes) {
+                // Колонки идут слева направо (при карусели - с переходом в начало строки)
+                if (source_x < prev_source_x) mode_segment = 0;
+                while (mode_segment + 1 < _segmentCount && source_x >= _segmentEnd[mode_segment]) mode_segment++;
+                mode = _segments[mode_segment].drawMode;
+                prev_source_x = source_x;
+            }
+
+            if (pre_shifted) {
+                // --- Строка уже сдвинута: одна запись по маске на байт ---
+                for (int16_t p = p_first; p < p_last; p++) {
+                    uint8_t data_byte = source_col[p * _lineBufferWidth] & cover[p];
+                    // Нельзя пропускать нули в режиме REPLACE, иначе фон не очистится!
+                    if (data_byte == 0 && mode != REPLACE) continue;
+                    uint8_t* dest = _pageRow(y_page_start + p) + screen_x;
+                    switch (mode) {
+                        case REPLACE: *dest = (*dest & ~cover[p]) | data_byte; break;
+                        case ADD_UP:  *dest |= data_byte; break;
+                        case INV_AUTO: *dest ^= data_byte; break;
+                    }
+                }
+                continue;
+            }
+
+            // ---  Строка во всю высоту буфера: каждый байт делится на две страницы экрана
             for (uint8_t p = 0; p < _lineBufferHeightPages; p++) {
-                uint32_t source_idx = (uint32_t)source_x + (uint32_t)p * _lineBufferWidth;
-                
-                uint8_t data_byte = _lineBuffer.get()[source_idx];
+                uint8_t data_byte = source_col[p * _lineBufferWidth];
 
                 // Нельзя пропускать нули в режиме REPLACE, иначе фон не очистится!
                 // Пропускаем только если это ADD_UP или INV_AUTO и байт пустой.
-                if (data_byte == 0 && _drawMode != REPLACE) continue; 
+                if (data_byte == 0 && mode != REPLACE) continue; 
 
-                uint8_t dest_page_top = y_page_start + p;
-                uint8_t dest_page_bottom = dest_page_top + 1;
+                int16_t dest_page_top = y_page_start + p;
+                int16_t dest_page_bottom = dest_page_top + 1;
+                // Маски пусты для страниц вне экрана и вне окна отсечения
+                uint8_t page_cover_top = cover_top_at[p];
+                uint8_t page_cover_bottom = cover_bottom_at[p];
+                bool top_visible = (page_cover_top != 0);
+                bool bottom_visible = (page_cover_bottom != 0);
 
                 // Данные, сдвинутые на нужную позицию
-                uint8_t mask_top = data_byte << y_offset;
-                uint8_t mask_bottom = (y_offset > 0) ? (data_byte >> (8 - y_offset)) : 0;  
+                uint8_t mask_top = (data_byte << y_offset) & page_cover_top;
+                uint8_t mask_bottom = ((y_offset > 0) ? (data_byte >> (8 - y_offset)) : 0) & page_cover_bottom;
 
-                // Защитная маска (Cover Mask). 
-                // Она показывает, какие биты в байте дисплея МЫ ИМЕЕМ ПРАВО трогать.
-                // 1 = это зона нашего символа (здесь мы пишем данные или стираем фон).
-                // 0 = это зона выше/ниже символа в этом байте (её трогать нельзя).
-                uint8_t cover_top = 0xFF << y_offset;
-                uint8_t cover_bottom = (y_offset > 0) ? (0xFF >> (8 - y_offset)) : 0;
-
-                switch (_drawMode) {  
+                switch (mode) {  
                     case REPLACE: {  
                         // Логика: (СтарыйФон & ~ГдеМыРисуем) | (НовыеДанные & ГдеМыРисуем)
                         // Это работает даже если НовыеДанные == 0 (стирает фон)
-                        if (dest_page_top < pages) {
-                            uint32_t idx = screen_x + dest_page_top * _width;
-                            _buffer.get()[idx] = (_buffer.get()[idx] & ~cover_top) | (mask_top & cover_top);
+                        if (top_visible) {
+                            uint8_t &dest = _pageRow(dest_page_top)[screen_x];
+                            dest = (dest & ~page_cover_top) | mask_top;
                         }
-                        if (y_offset > 0 && dest_page_bottom < pages) {
-                            uint32_t idx = screen_x + dest_page_bottom * _width;
-                            _buffer.get()[idx] = (_buffer.get()[idx] & ~cover_bottom) | (mask_bottom & cover_bottom);
+                        if (bottom_visible) {
+                            uint8_t &dest = _pageRow(dest_page_bottom)[screen_x];
+                            dest = (dest & ~page_cover_bottom) | mask_bottom;
                         }
                         break;  
                     }  
                     case ADD_UP: {  
                         // Просто наложение (OR)
-                        if (dest_page_top < pages) _buffer.get()[screen_x + dest_page_top * _width] |= mask_top;  
-                        if (y_offset > 0 && dest_page_bottom < pages) _buffer.get()[screen_x + dest_page_bottom * _width] |= mask_bottom;  
+                        if (top_visible) _pageRow(dest_page_top)[screen_x] |= mask_top;
+                        if (bottom_visible) _pageRow(dest_page_bottom)[screen_x] |= mask_bottom;
                         break;  
                     }  
                     case INV_AUTO: {  
                         // Инверсия (XOR). Фон инвертируется только там, где есть пиксели символа.
-                        if (dest_page_top < pages) _buffer.get()[screen_x + dest_page_top * _width] ^= mask_top;  
-                        if (y_offset > 0 && dest_page_bottom < pages) _buffer.get()[screen_x + dest_page_bottom * _width] ^= mask_bottom;  
+                        if (top_visible) _pageRow(dest_page_top)[screen_x] ^= mask_top;
+                        if (bottom_visible) _pageRow(dest_page_bottom)[screen_x] ^= mask_bottom;
                         break;  
                     }  
                 }
@@ -619,90 +1470,23 @@ void SavaOLED_ESP32::drawPrint() {
 
 void SavaOLED_ESP32::drawPrintVert() {
     if (_segmentCount == 0) return;
+    if (_renderTaskHandle) {
+        OLED_ERROR("drawPrintVert: not available with renderTask");
+        return;
+    }
 
-    // --- ПРОХОД 1: ИЗМЕРЕНИЕ ВЫСОТЫ ТЕКСТА ---
-    struct CharLayout {
-        uint16_t index;
-        uint8_t raw_width;
-        uint8_t skip_top;
-        uint8_t real_height;
-        bool is_space;
-    };
+    // --- ШАГ 1: Рендер ленты в _vertBuffer (только если текст изменился) ---
+    // cursor()/print() вызываются каждый кадр, поэтому сравниваем подпись содержимого, а не _lineChanged
+    uint32_t signature = _vertTextSignature();
+    if (signature != _vertSignature) {
+        _renderVertTape();
+        _vertSignature = signature;
+    }
+    if (_vertBufferHeight == 0 || _vertBufferWidth == 0) return;
 
-    CharLayout layouts[128];
-    uint16_t layout_count = 0;
-    uint16_t total_pixel_height = 0;
+    const uint16_t total_pixel_height = _vertBufferHeight;
     const uint8_t gap = 24; // Промежуток между повторами текста
 
-    for (uint8_t s = 0; s < _segmentCount; ++s) {
-        const auto& segment = _segments[s];
-        if (!segment.fontPtr || !segment.text) continue;
-        const savaFont* fontPtr = segment.fontPtr;
-        uint8_t font_h_pixels = fontPtr->height;
-        int i = 0;
-        while (segment.text[i] != '\0' && layout_count < 128) {
-            uint16_t char_code = (uint8_t)segment.text[i];
-            if (char_code < 128) {
-                i++;
-            } else {
-                char_code = utf8_to_cp1251((uint8_t)segment.text[i], (uint8_t)segment.text[i + 1]);
-                i += 2;
-            }
-            uint16_t index = _getCharIndex(fontPtr, char_code);
-            if (index == 0xFFFF) continue;
-
-            const uint8_t* char_ptr = &fontPtr->data[fontPtr->offsets[index]];
-            uint8_t raw_width = *char_ptr;
-            const uint8_t* pixels = char_ptr + 1;
-
-            // Пропуск пустых строк сверху
-            uint8_t empty_top = 0;
-            for (int row = 0; row < font_h_pixels; row++) {
-                bool row_is_empty = true;
-                for (int col = 0; col < raw_width; col++) {
-                    uint8_t p = row / 8;
-                    uint8_t b = row % 8;
-                    if (pixels[p * raw_width + col] & (1 << b)) {
-                        row_is_empty = false;
-                        break;
-                    }
-                }
-                if (!row_is_empty) break;
-                empty_top++;
-            }
-
-            CharLayout l;
-            l.index = index;
-            l.raw_width = raw_width;
-            l.skip_top = empty_top;
-
-            if (empty_top == font_h_pixels) {
-                l.is_space = true;
-                l.real_height = (font_h_pixels > 4) ? (font_h_pixels / 3) : 4;
-            } else {
-                uint8_t empty_bottom = 0;
-                for (int row = font_h_pixels - 1; row >= (int)empty_top; row--) {
-                    bool row_is_empty = true;
-                    for (int col = 0; col < raw_width; col++) {
-                        uint8_t p = row / 8;
-                        uint8_t b = row % 8;
-                        if (pixels[p * raw_width + col] & (1 << b)) {
-                            row_is_empty = false;
-                            break;
-                        }
-                    }
-                    if (!row_is_empty) break;
-                    empty_bottom++;
-                }
-                l.real_height = font_h_pixels - empty_top - empty_bottom;
-            }
-            total_pixel_height += l.real_height + _charSpacing;
-            layouts[layout_count++] = l;
-        }
-    }
-    if (layout_count == 0) return;
-    if (total_pixel_height > 0) total_pixel_height -= _charSpacing; // убираем последний интервал
-
     // --- ОПРЕДЕЛЕНИЕ ОКНА ОТРИСОВКИ ---
     int16_t win_top = _cursorY;
     int16_t win_bottom = _height;
@@ -715,6 +1499,7 @@ void SavaOLED_ESP32::drawPrintVert() {
 
     // --- РАСЧЁТ СДВИГА ДЛЯ СКРОЛЛА ---
     int32_t start_draw_y = win_top;
+    uint32_t loop_length = total_pixel_height + gap;
 
     if (_scrollEnabled && _cursorAlign == StrScroll) {
         unsigned long currentTime = millis();
@@ -727,7 +1512,6 @@ void SavaOLED_ESP32::drawPrintVert() {
             _vertLastScrollTime = currentTime;
             _vertScrollOffset += steps;
         }
-        uint32_t loop_length = total_pixel_height + gap;
         // Используем _vertScrollOffset для расчета смещения
         int32_t offset = _vertScrollOffset % loop_length;
         
@@ -741,107 +1525,1122 @@ void SavaOLED_ESP32::drawPrintVert() {
         }
     }
 
+    bool looping = _scrollEnabled && _cursorAlign == StrScroll && _scrollLoop;
     const uint8_t pages_total = _height / 8;
-    int passes = (_scrollEnabled && _cursorAlign == StrScroll && _scrollLoop) ? 2 : 1;
-
-    // --- ПРОХОД 2: ОТРИСОВКА (с поддержкой цикла) ---
-    for (int p_cycle = 0; p_cycle < passes; p_cycle++) {
-        int32_t screen_y = start_draw_y;
-
-        // Второй проход: текст "подтягивается снизу"
-        if (p_cycle == 1) {
-            screen_y += (total_pixel_height + gap);
+    int16_t page_first = win_top / 8;
+    int16_t page_last = (win_bottom - 1) / 8;
+    if (page_first < _bufferPage0) page_first = _bufferPage0; // в постраничном режиме - только страницы полосы
+    if (page_last >= _bufferPage0 + _bufferPages) page_last = _bufferPage0 + _bufferPages - 1;
+    if (page_last >= pages_total) page_last = pages_total - 1;
+
+    // --- ШАГ 2: Копирование сдвинутого "окна" ленты в _buffer ---
+    for (int16_t dest_page = page_first; dest_page <= page_last; dest_page++) {
+        int16_t page_start_px = dest_page * 8;
+        int16_t page_end_px = page_start_px + 8;
+
+        uint8_t clip_mask = 0xFF;
+        if (win_top > page_start_px) {
+            clip_mask &= (0xFF << (win_top - page_start_px));
+        }
+        if (win_bottom < page_end_px) {
+            clip_mask &= (0xFF >> (page_end_px - win_bottom));
         }
 
-        for (uint16_t k = 0; k < layout_count; k++) {
-            CharLayout l = layouts[k];
+        // Позиция верхнего бита страницы внутри ленты
+        int32_t src_y = page_start_px - start_draw_y;
+        if (looping) {
+            src_y %= (int32_t)loop_length;
+            if (src_y < 0) src_y += loop_length;
+        }
 
-            // Проверка видимости
-            if (screen_y + l.real_height <= win_top || screen_y >= win_bottom) {
-                screen_y += l.real_height + _charSpacing;
-                continue;
+        for (uint8_t col = 0; col < _vertBufferWidth; col++) {
+            int16_t draw_x = _cursorX + col;
+            if (draw_x < 0 || draw_x >= _width) continue;
+
+            uint8_t byte_data, byte_mask;
+            _fetchVertTape(col, src_y, byte_data, byte_mask);
+            // Хвост страницы за концом цикла берём из начала ленты (следующий повтор)
+            if (looping && src_y + 8 > (int32_t)loop_length) {
+                uint8_t head = loop_length - src_y;
+                uint8_t wrap_data, wrap_mask;
+                _fetchVertTape(col, 0, wrap_data, wrap_mask);
+                byte_data |= wrap_data << head;
+                byte_mask |= wrap_mask << head;
+            }
+            byte_mask &= clip_mask;
+            if (!byte_mask) continue;
+
+            uint8_t &dest = _pageRow(dest_page)[draw_x];
+            if (_drawMode == REPLACE) {
+                dest = (dest & ~byte_mask) | (byte_data & byte_mask);
+            } else if (_drawMode == ADD_UP) {
+                dest |= (byte_data & byte_mask);
+            } else if (_drawMode == INV_AUTO) {
+                dest ^= (byte_data & byte_mask);
             }
+        }
+    }
+}
 
-            const savaFont* fontPtr = _segments[0].fontPtr;
-            const uint8_t* pixels = &fontPtr->data[fontPtr->offsets[l.index]] + 1;
-            uint8_t pages_per_char = (fontPtr->height + 7) / 8;
+void SavaOLED_ESP32::textBox(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t align, uint8_t lineSpacing, bool wordWrap) {
+    _boxX = x;
+    _boxY = y;
+    _boxW = (w > 0) ? w : 1;
+    _boxH = (h > 0) ? h : 0;
+    _boxAlign = (align == StrCenter || align == StrRight) ? align : StrLeft;
+    _boxLineSpacing = lineSpacing;
+    _boxWordWrap = wordWrap;
+}
 
-            int16_t base_page_y = (screen_y >= 0) ? (screen_y / 8) : ((screen_y - 7) / 8);
-            uint8_t y_bit_shift = (screen_y >= 0) ? (screen_y % 8) : (8 + (screen_y % 8));
-            if (y_bit_shift == 8) y_bit_shift = 0;
+void SavaOLED_ESP32::drawTextBox(const char* text) {
+    if (!text || !_currentFont) return;
+    size_t text_len = strlen(text);
+    uint16_t length = (text_len > 0xFFFF) ? 0xFFFF : text_len;
+
+    // --- Переносы пересчитываются только при изменении текста или параметров ---
+    uint32_t hash = 2166136261UL;
+    auto mix = [&hash](uint32_t v) { hash = (hash ^ v) * 16777619UL; };
+    mix((uint32_t)(uintptr_t)_currentFont);
+    mix(_textScale);
+    mix(_charSpacing);
+    mix((uint16_t)_boxW);
+    mix(_boxWordWrap);
+    mix(length);
+    for (uint16_t i = 0; i < length; i++) mix((uint8_t)text[i]);
+    if (hash != _boxSignature || _boxLineCount == 0) {
+        _layoutTextBox(text, length);
+        _boxSignature = hash;
+    }
 
-            for (uint8_t col = 0; col < l.raw_width; col++) {
-                int16_t draw_x = _cursorX + col;
-                if (draw_x < 0 || draw_x >= _width) continue;
+    // --- Видимые строки: только целиком помещающиеся по высоте ---
+    uint16_t line_height = _currentFont->height * _textScale;
+    uint16_t line_step = line_height + _boxLineSpacing;
+    uint16_t visible = (_boxH >= line_height) ? ((_boxH - line_height) / line_step + 1) : 0;
+    uint16_t max_first = (_boxLineCount > visible) ? (_boxLineCount - visible) : 0;
+    if (_boxFirstLine > max_first) _boxFirstLine = max_first;
+
+    for (uint16_t k = 0; k < visible; k++) {
+        uint16_t line = _boxFirstLine + k;
+        if (line >= _boxLineCount) break;
+        cursor(_boxX, _boxY + k * line_step, _boxAlign, _boxW);
+        printRef(text + _boxLines[line].start, _boxLines[line].length);
+        drawPrint();
+    }
+    cursor(_boxX, _boxY, _boxAlign, _boxW); // строка print() после textBox не должна ссылаться на text
+}
 
-                // Собираем данные символа
-                uint32_t col_data = 0;
-                for (uint8_t p = 0; p < pages_per_char; p++) {
-                    col_data |= ((uint32_t)pixels[p * l.raw_width + col]) << (p * 8);
-                }
-                col_data >>= l.skip_top;
-                if (l.real_height < 32) {
-                    col_data &= (1UL << l.real_height) - 1;
-                }
+void SavaOLED_ESP32::textBoxScroll(int16_t lines) {
+    int32_t first = (int32_t)_boxFirstLine + lines;
+    if (first < 0) first = 0;
+    if (first > _boxLineCount) first = _boxLineCount; // точное ограничение - в drawTextBox() по высоте области
+    _boxFirstLine = first;
+}
 
-                uint64_t render_data = (uint64_t)col_data << y_bit_shift;
-                uint64_t render_mask = (uint64_t)((1ULL << l.real_height) - 1) << y_bit_shift;
-
-                // Нанесение по страницам
-                for (int p_off = 0; p_off < 5 && render_mask; p_off++) {
-                    int16_t dest_page = base_page_y + p_off;
-                    if (dest_page < 0 || dest_page >= pages_total) {
-                        render_data >>= 8;
-                        render_mask >>= 8;
-                        continue;
-                    }
+uint16_t SavaOLED_ESP32::getTextBoxLines() const {
+    return _boxLineCount;
+}
 
-                    int16_t page_start_px = dest_page * 8;
-                    int16_t page_end_px = page_start_px + 8;
-                    int16_t overlap_start = max(page_start_px, win_top);
-                    int16_t overlap_end = min(page_end_px, win_bottom);
+uint16_t SavaOLED_ESP32::getTextBoxFirstLine() const {
+    return _boxFirstLine;
+}
 
-                    if (overlap_start >= overlap_end) {
-                        render_data >>= 8;
-                        render_mask >>= 8;
-                        continue;
-                    }
+void SavaOLED_ESP32::numberWidget(NumberWidget &widget, int16_t x, int16_t y, const savaFont &font, uint8_t cells, uint8_t rollFrames, uint8_t spacing) {
+    if (cells > NumberWidget::MAX_CELLS) {
+        OLED_WARN("numberWidget: %d cells requested, max %d", cells, NumberWidget::MAX_CELLS);
+        cells = NumberWidget::MAX_CELLS;
+    }
+    widget.x = x;
+    widget.y = y;
+    widget.fontPtr = &font;
+    widget.cells = cells;
+    widget.spacing = spacing;
+    widget.rollFrames = rollFrames;
+    widget.drawn = false;
+    widget.dirtyX = x;
+    widget.dirtyWidth = 0;
+    widget.dirtyCells = 0;
+
+    // Знакоместо - по самой широкой цифре, чтобы число не "гуляло" при смене значений
+    widget.cellWidth = 0;
+    for (char digit = '0'; digit <= '9'; digit++) {
+        uint16_t index = _getCharIndex(&font, digit);
+        if (index == 0xFFFF) continue;
+        uint8_t width = glyph_width(&font.data[font.offsets[index]]);
+        if (width > widget.cellWidth) widget.cellWidth = width;
+    }
+    if (widget.cellWidth == 0) widget.cellWidth = glyph_width(&font.data[font.offsets[0]]);
 
-                    uint8_t clip_mask = 0xFF;
-                    if (win_top > page_start_px) {
-                        clip_mask &= (0xFF << (win_top - page_start_px));
-                    }
-                    if (win_bottom < page_end_px) {
-                        clip_mask &= (0xFF >> (page_end_px - win_bottom));
-                    }
+    for (uint8_t i = 0; i < NumberWidget::MAX_CELLS; i++) {
+        widget.from[i] = ' ';
+        widget.to[i] = ' ';
+        widget.phase[i] = 0;
+    }
+}
 
-                    uint32_t idx = draw_x + dest_page * _width;
-                    uint8_t byte_data = (uint8_t)(render_data & 0xFF);
-                    uint8_t byte_mask = (uint8_t)(render_mask & 0xFF) & clip_mask;
-
-                    if (byte_mask) {
-                        if (_drawMode == REPLACE) {
-                            _buffer.get()[idx] = (_buffer.get()[idx] & ~byte_mask) | (byte_data & byte_mask);
-                        } else if (_drawMode == ADD_UP) {
-                            _buffer.get()[idx] |= (byte_data & byte_mask);
-                        } else if (_drawMode == INV_AUTO) {
-                            _buffer.get()[idx] ^= (byte_data & byte_mask);
-                        }
-                    }
+bool SavaOLED_ESP32::drawNumber(NumberWidget &widget, const char* text) {
+    if (!widget.fontPtr || !text) return false;
+    if (_renderTaskHandle) {
+        // Рисует прямо в кадр, которым владеет задача рендера, - в очередь такую команду не записать
+        OLED_ERROR("drawNumber: not available with renderTask");
+        return false;
+    }
 
-                    render_data >>= 8;
-                    render_mask >>= 8;
-                }
+    // --- Новые символы знакомест: текст выравнивается вправо, лишнее слева отбрасывается ---
+    uint32_t codes[NumberWidget::MAX_CELLS + 1];
+    uint8_t count = 0;
+    uint16_t length = strlen(text);
+    uint16_t i = 0;
+    while (i < length) {
+        uint32_t code_point = utf8_next(text, length, i);
+        if (count == NumberWidget::MAX_CELLS + 1) { // держим только последние знаки
+            memmove(codes, codes + 1, NumberWidget::MAX_CELLS * sizeof(uint32_t));
+            count--;
+        }
+        codes[count++] = code_point;
+    }
+    uint8_t skip = (count > widget.cells) ? (count - widget.cells) : 0;
+    uint8_t pad = widget.cells - (count - skip);
+
+    widget.dirtyWidth = 0;
+    widget.dirtyCells = 0;
+    int16_t dirty_first = -1;
+    int16_t dirty_last = -1;
+    bool rolling = false;
+    uint8_t height = (widget.fontPtr->height < 32) ? widget.fontPtr->height : 32;
+
+    for (uint8_t cell = 0; cell < widget.cells; cell++) {
+        uint32_t code = (cell < pad) ? ' ' : codes[skip + cell - pad];
+        bool redraw = !widget.drawn;
+        if (code != widget.to[cell]) {
+            // Новый символ: прокрутка начинается с того, к которому шли (незаконченная обрывается)
+            widget.from[cell] = widget.to[cell];
+            widget.to[cell] = code;
+            widget.phase[cell] = (widget.rollFrames > 0 && widget.drawn) ? 1 : 0;
+            redraw = true;
+        }
+        if (widget.phase[cell] > 0) {
+            // Кадр прокрутки: старый символ уходит вверх на долю высоты, новый поднимается снизу.
+            // Последний кадр (phase == rollFrames + 1) показывает новый символ целиком.
+            uint8_t offset = (uint16_t)height * widget.phase[cell] / (widget.rollFrames + 1);
+            _drawNumberCell(widget, cell, offset);
+            if (widget.phase[cell] > widget.rollFrames) {
+                widget.phase[cell] = 0;
+                widget.from[cell] = widget.to[cell];
+            } else {
+                widget.phase[cell]++;
+                rolling = true;
             }
-            screen_y += l.real_height + _charSpacing;
+        } else if (redraw) {
+            _drawNumberCell(widget, cell, height);
+        } else {
+            continue;
+        }
+        widget.dirtyCells |= 1U << cell;
+        if (dirty_first < 0) dirty_first = cell;
+        dirty_last = cell;
+    }
+    widget.drawn = true;
+
+    if (dirty_first >= 0) {
+        uint8_t pitch = widget.cellWidth + widget.spacing;
+        widget.dirtyX = widget.x + dirty_first * pitch;
+        widget.dirtyWidth = (dirty_last - dirty_first) * pitch + widget.cellWidth;
+    }
+    return rolling;
+}
+
+bool SavaOLED_ESP32::drawNumber(NumberWidget &widget, int32_t value) {
+    char text[16];
+    uint32_t magnitude = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+    text[_emitInteger(text, sizeof(text) - 1, value < 0, magnitude, 0)] = '\0';
+    return drawNumber(widget, text);
+}
+
+bool SavaOLED_ESP32::drawNumber(NumberWidget &widget, float value, uint8_t decimals) {
+    char text[24];
+    text[_emitFloat(text, sizeof(text) - 1, value, decimals, 0)] = '\0';
+    return drawNumber(widget, text);
+}
+
+bool SavaOLED_ESP32::chartWidget(ChartWidget &chart, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t style, float minY, float maxY) {
+    if (w == 0 || h == 0) {
+        OLED_ERROR("chartWidget: empty area %ux%u", w, h);
+        return false;
+    }
+    if (style != CHART_LINE && style != CHART_BAR && style != CHART_DOT) {
+        OLED_WARN("chartWidget: unsupported style %u, using CHART_LINE", style);
+        style = CHART_LINE;
+    }
+    // Лишний отсчёт - начало отрезка CHART_LINE в левой колонке
+    chart.samples = std::make_unique<float[]>(w + 1);
+    chart.x = x;
+    chart.y = y;
+    chart.w = w;
+    chart.h = h;
+    chart.style = style;
+    chart.autoScale = (minY == maxY);
+    chart.minY = chart.autoScale ? 0 : ((minY < maxY) ? minY : maxY);
+    chart.maxY = chart.autoScale ? 0 : ((minY < maxY) ? maxY : minY);
+    chart.head = 0;
+    chart.count = 0;
+    chart.drawn = false;
+    return true;
+}
+
+bool SavaOLED_ESP32::drawChart(ChartWidget &chart, float value) {
+    if (!chart.samples) return false;
+    // Кольцо пишется всегда, даже если нарисовать сейчас нельзя
+    chart.samples[chart.head] = value;
+    chart.head = (chart.head < chart.w) ? chart.head + 1 : 0;
+    if (chart.count <= chart.w) chart.count++;
+    if (_listRecording || _renderTaskHandle || (_stripPages && !_canvasTarget)) {
+        OLED_ERROR("drawChart: not available while recording a list, with renderTask or in pageMode");
+        chart.drawn = false;
+        return false;
+    }
+    auto sample = [&](uint16_t age) -> float {  // age 0 - новейший отсчёт
+        int16_t i = (int16_t)chart.head - 1 - age;
+        return chart.samples[(i < 0) ? i + chart.w + 1 : i];
+    };
+    bool rescaled = chart.autoScale && chart_autoscale(chart);
+    // Колонки за краем холста не хранятся - такую область сдвигом не обновить
+    bool inside = chart.x >= 0 && chart.y >= 0 && chart.x + chart.w <= _width && chart.y + chart.h <= _height;
+
+    if (chart.drawn && !rescaled && inside) {
+        // Сдвиг на колонку влево и одна новая колонка справа
+        scrollRect(chart.x, chart.y, chart.w, chart.h, -1, 0);
+        float prev = (chart.count > 1) ? sample(1) : NAN;
+        _drawChartColumn(chart, chart.x + chart.w - 1, prev, value);
+        return false;
+    }
+    // Вся область: отсчёты прижаты к правому краю, новейший - в последней колонке
+    clearRect(chart.x, chart.y, chart.w, chart.h);
+    for (uint16_t age = (chart.count < chart.w) ? chart.count : chart.w; age-- > 0;) {
+        float prev = (age + 1 < chart.count) ? sample(age + 1) : NAN;
+        _drawChartColumn(chart, chart.x + chart.w - 1 - age, prev, sample(age));
+    }
+    chart.drawn = true;
+    return true;
+}
+
+void SavaOLED_ESP32::drawChartAxis(const ChartWidget &chart, const savaFont &labelFont, uint8_t decimals) {
+    if (chart.w == 0) return;
+    // Место подписей - колонки слева от области, в её строках
+    rect(0, chart.y, chart.x - 1, chart.h, ERASE, FILL);
+    vLine(chart.x - 1, chart.y, chart.h + 1, REPLACE);
+    hLine(chart.x - 1, chart.y + chart.h, chart.w + 1, REPLACE);
+    // Подписи выравниваются вправо к колонке x - 3: левее x = 4 для них нет места
+    if (chart.maxY <= chart.minY || chart.x < 4) return;
+
+    // Шрифт, курсор и ещё не нарисованные print() пользователя восстанавливаются после подписей.
+    // Текст подписей пишется в _textBuffer за текстом пользователя, поэтому его сегменты остаются верными
+    TextSegment user_segments[MAX_SEGMENTS];
+    memcpy(user_segments, _segments, sizeof(user_segments));
+    uint8_t user_count = _segmentCount;
+    size_t user_pos = _textBufferPos;
+    int16_t user_x = _cursorX, user_y = _cursorY, user_x2 = _cursorX2;
+    uint8_t user_align = _cursorAlign;
+    const savaFont* user_font = _currentFont;
+    uint8_t user_mode = _drawMode;
+    uint8_t user_scale = _textScale;
+    bool user_scroll = _scrollEnabled;
+    uint16_t user_width = _currentLineWidth;
+
+    _currentFont = &labelFont;
+    _drawMode = REPLACE;
+    _textScale = 1;
+    _scrollEnabled = false;
+    for (uint8_t i = 0; i < 2; i++) {
+        _cursorX = 0;
+        _cursorY = i ? (chart.y + chart.h - labelFont.height) : chart.y;
+        _cursorAlign = StrRight;
+        _cursorX2 = chart.x - 3;
+        _segmentCount = 0;
+        _textBufferPos = user_pos;
+        _lineChanged = true;
+        print(i ? chart.minY : chart.maxY, decimals);
+        drawPrint();
+    }
+
+    memcpy(_segments, user_segments, sizeof(user_segments));
+    _segmentCount = user_count;
+    _textBufferPos = user_pos;
+    _cursorX = user_x;
+    _cursorY = user_y;
+    _cursorX2 = user_x2;
+    _cursorAlign = user_align;
+    _currentFont = user_font;
+    _drawMode = user_mode;
+    _textScale = user_scale;
+    _scrollEnabled = user_scroll;
+    _currentLineWidth = user_width;
+    _lineChanged = true; // Буфер строки занят подписями - строка пользователя соберётся заново
+}
+
+void SavaOLED_ESP32::displayList(uint8_t maxItems, uint16_t textBytes) {
+    _listRecording = false;
+    _listValid = false;
+    _listCount = 0;
+    _listPrevCount = 0;
+    _listRedrawn = 0;
+    _listDirtyX0 = _listDirtyY0 = _listDirtyX1 = _listDirtyY1 = 0;
+    if (maxItems == 0) {
+        _listItems.reset();
+        _listPrev.reset();
+        _listSegments.reset();
+        _listText.reset();
+        _listCapacity = 0;
+        _listTextSize = 0;
+        return;
+    }
+    _listItems = std::make_unique<DisplayListItem[]>(maxItems);
+    _listPrev = std::make_unique<DisplayListItem[]>(maxItems);
+    _listSegments = std::make_unique<TextSegment[]>(maxItems);
+    _listText = std::make_unique<char[]>(textBytes ? textBytes : 1);
+    _listCapacity = maxItems;
+    _listTextSize = textBytes;
+}
+
+void SavaOLED_ESP32::listBegin() {
+    if (_renderTaskHandle) {
+        OLED_ERROR("listBegin: not available with renderTask (use frameBegin / frameEnd)");
+        return;
+    }
+    if (_listCapacity == 0) {
+        OLED_WARN("listBegin: display list is not allocated (call displayList first)");
+        return;
+    }
+    if (_canvasTarget) {
+        OLED_ERROR("listBegin: call canvasEnd first");
+        return;
+    }
+    _listCount = 0;
+    _listSegmentCount = 0;
+    _listTextUsed = 0;
+    _listRecording = true;
+}
+
+bool SavaOLED_ESP32::listEnd() {
+    if (!_listRecording) return false;
+    _listRecording = false;
+
+    // --- Изменённые области: старые и новые габариты команд, чья подпись не совпала ---
+    static const uint8_t MAX_DIRTY = 4;
+    int16_t dirty[MAX_DIRTY][4];
+    uint8_t dirty_count = 0;
+    auto add_dirty = [&](int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+        if (x0 < 0) x0 = 0;
+        if (y0 < 0) y0 = 0;
+        if (x1 > _width) x1 = _width;
+        if (y1 > _height) y1 = _height;
+        if (x0 >= x1 || y0 >= y1) return;
+        // Пересекающиеся и соседние области объединяются; при переполнении - с той, что растёт меньше всего
+        int8_t target = -1;
+        int32_t best_growth = 0;
+        for (uint8_t r = 0; r < dirty_count; r++) {
+            int16_t* d = dirty[r];
+            bool touch = (x0 <= d[2] && d[0] <= x1 && y0 <= d[3] && d[1] <= y1);
+            int32_t growth = (int32_t)(((x1 > d[2]) ? x1 : d[2]) - ((x0 < d[0]) ? x0 : d[0])) *
+                             (((y1 > d[3]) ? y1 : d[3]) - ((y0 < d[1]) ? y0 : d[1])) -
+                             (int32_t)(d[2] - d[0]) * (d[3] - d[1]);
+            if (touch) { target = r; break; }
+            if (dirty_count == MAX_DIRTY && (target < 0 || growth < best_growth)) { target = r; best_growth = growth; }
+        }
+        if (target < 0) {
+            int16_t* d = dirty[dirty_count++];
+            d[0] = x0; d[1] = y0; d[2] = x1; d[3] = y1;
+            return;
+        }
+        int16_t* d = dirty[target];
+        if (x0 < d[0]) d[0] = x0;
+        if (y0 < d[1]) d[1] = y0;
+        if (x1 > d[2]) d[2] = x1;
+        if (y1 > d[3]) d[3] = y1;
+    };
+
+    for (uint8_t i = 0; i < _listCount; i++) _listItems[i].signature = _listSignature(_listItems[i]);
+
+    if (!_listValid) {
+        add_dirty(0, 0, _width, _height);
+    } else {
+        uint8_t total = (_listCount > _listPrevCount) ? _listCount : _listPrevCount;
+        for (uint8_t i = 0; i < total; i++) {
+            const DisplayListItem* cur = (i < _listCount) ? &_listItems[i] : nullptr;
+            const DisplayListItem* prev = (i < _listPrevCount) ? &_listPrev[i] : nullptr;
+            bool animated = cur && cur->type == DL_TEXT && (cur->flags & 0x80); // бегущая строка меняется со временем
+            if (cur && prev && !animated && cur->signature == prev->signature) continue;
+            if (prev) add_dirty(prev->x0, prev->y0, prev->x1, prev->y1);
+            if (cur) add_dirty(cur->x0, cur->y0, cur->x1, cur->y1);
+        }
+    }
+
+    // Записанный кадр становится предыдущим (массивы меняются местами) и перерисовывается из него
+    std::swap(_listItems, _listPrev);
+    _listPrevCount = _listCount;
+    _listValid = true;
+
+    _listDirtyX0 = _width;
+    _listDirtyY0 = _height;
+    _listDirtyX1 = 0;
+    _listDirtyY1 = 0;
+    for (uint8_t r = 0; r < dirty_count; r++) {
+        if (dirty[r][0] < _listDirtyX0) _listDirtyX0 = dirty[r][0];
+        if (dirty[r][1] < _listDirtyY0) _listDirtyY0 = dirty[r][1];
+        if (dirty[r][2] > _listDirtyX1) _listDirtyX1 = dirty[r][2];
+        if (dirty[r][3] > _listDirtyY1) _listDirtyY1 = dirty[r][3];
+    }
+    if (dirty_count == 0) _listDirtyX0 = _listDirtyY0 = 0;
+    _listReplay(dirty, dirty_count);
+    return dirty_count > 0;
+}
+
+void SavaOLED_ESP32::listInvalidate() {
+    _listValid = false;
+}
+
+void SavaOLED_ESP32::pageMode(uint8_t stripPages) {
+    const uint8_t canvas_pages = _height / 8;
+    if (stripPages >= canvas_pages) stripPages = 0; // полоса во весь экран - это обычный кадровый буфер
+    if (stripPages == _stripPages) return;
+    if (stripPages && _canvasTurn != ROT_0) {
+        OLED_ERROR("pageMode: not available with canvasRotation");
+        return;
+    }
+    if (stripPages && (_renderTaskHandle || _queueSlots)) {
+        OLED_ERROR("pageMode: not available with renderTask / commandQueue");
+        return;
+    }
+    if (_canvasTarget) {
+        OLED_ERROR("pageMode: call canvasEnd first");
+        return;
+    }
+    if (stripPages && _layerCount) {
+        OLED_ERROR("pageMode: not available with layers");
+        return;
+    }
+    _stripPages = stripPages;
+    // Кадр выделяется заново - сохранённые под окнами области больше не к чему возвращать
+    _overlayDepth = 0;
+    _overlayUsed = 0;
+    // Старые буферы освобождаются до выделения новых: пик памяти - больший из режимов, а не их сумма
+    _buffer.reset();
+    _tx_buffer.reset();
+    _lineBuffer.reset();
+    _lineBufferWidth = 0;
+    _lineChanged = true;
+    if (stripPages) {
+        // Полоса stripPages x _width и буфер передачи одной страницы вместо кадра и его копии.
+        // Буфер строки - шириной с экран, при первом drawPrint()
+        _bufferPages = stripPages;
+        _buffer = std::make_unique<uint8_t[]>(stripPages * _width);
+        _tx_buffer = std::make_unique<uint8_t[]>(_width + 1);
+    } else {
+        _bufferPages = canvas_pages;
+        _buffer = std::make_unique<uint8_t[]>(_bufferSize);
+        _tx_buffer = std::make_unique<uint8_t[]>(_bufferSize + 1);
+        _lineBufferWidth = LINE_BUFFER_WIDTH;
+        _lineBuffer = std::make_unique<uint8_t[]>(_lineBufferWidth * LINE_BUFFER_PAGES);
+    }
+    _target = _buffer.get();
+    _bufferPage0 = 0;
+    _resetClip();
+    _listValid = false;
+}
+
+uint32_t SavaOLED_ESP32::getBufferBytes() const {
+    uint32_t frame = _bufferPages * _width;
+    uint32_t tx = _stripPages ? (_width + 1) : (_bufferSize + 1);
+    uint32_t rot = _rotBuffer ? _bufferSize : 0;
+    uint32_t line = _lineBuffer ? (uint32_t)_lineBufferWidth * LINE_BUFFER_PAGES : 0;
+    uint32_t vert = _vertBuffer ? VERT_BUF_SIZE : 0;
+    // Список: два кадра команд, сегменты строк и копии текста (как выделяет displayList)
+    uint32_t list = 0;
+    if (_listCapacity) {
+        list = _listCapacity * (2 * sizeof(DisplayListItem) + sizeof(TextSegment)) + (_listTextSize ? _listTextSize : 1);
+    }
+    return frame + tx + rot + line + vert + list;
+}
+
+uint8_t SavaOLED_ESP32::getListItems() const {
+    return _listPrevCount;
+}
+
+uint8_t SavaOLED_ESP32::getListRedrawn() const {
+    return _listRedrawn;
+}
+
+void SavaOLED_ESP32::getListDirty(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const {
+    x = _listDirtyX0;
+    y = _listDirtyY0;
+    w = (_listDirtyX1 > _listDirtyX0) ? (_listDirtyX1 - _listDirtyX0) : 0;
+    h = (_listDirtyY1 > _listDirtyY0) ? (_listDirtyY1 - _listDirtyY0) : 0;
+}
+
+bool SavaOLED_ESP32::renderTask(uint8_t core, uint8_t priority, uint32_t stackBytes) {
+    if (_renderTaskHandle) return true;
+    if (_listCapacity == 0) {
+        OLED_ERROR("renderTask: command queue is not allocated (call displayList first)");
+        return false;
+    }
+    if (_stripPages) {
+        OLED_ERROR("renderTask: not available in pageMode");
+        return false;
+    }
+    if (_canvasTarget) {
+        OLED_ERROR("renderTask: call canvasEnd first");
+        return false;
+    }
+    if (_layerCount) {
+        OLED_ERROR("renderTask: not available with layers");
+        return false;
+    }
+    if (!_renderMutex) _renderMutex = xSemaphoreCreateMutex();
+    if (!_renderDone) _renderDone = xSemaphoreCreateBinary();
+    if (!_renderMutex || !_renderDone) {
+        OLED_ERROR("renderTask: failed to create semaphores");
+        return false;
+    }
+    // Память списка отображения становится очередью команд
+    _listRecording = false;
+    _listCount = 0;
+    _listSegmentCount = 0;
+    _listTextUsed = 0;
+    _listValid = false;
+    _renderStop = false;
+    // Кадр рисует задача рендера - сохранённые под окнами области больше не к чему возвращать
+    _overlayDepth = 0;
+    _overlayUsed = 0;
+    if (xTaskCreatePinnedToCore(_renderTaskEntry, "SavaOLED", stackBytes, this, priority,
+                                &_renderTaskHandle, core) != pdPASS) {
+        _renderTaskHandle = nullptr;
+        OLED_ERROR("renderTask: failed to create task");
+        return false;
+    }
+    OLED_LOG("Render task started on core %u", core);
+    return true;
+}
+
+void SavaOLED_ESP32::renderStop() {
+    if (!_renderTaskHandle) return;
+    xSemaphoreTake(_renderMutex, portMAX_DELAY); // не посреди порции другой задачи
+    _renderStop = true;
+    xSemaphoreGive(_renderMutex);
+    xTaskNotifyGive(_renderTaskHandle);
+    xSemaphoreTake(_renderDone, portMAX_DELAY);
+    _renderTaskHandle = nullptr;
+}
+
+void SavaOLED_ESP32::frameBegin() {
+    if (!_renderTaskHandle) return;
+    xSemaphoreTake(_renderMutex, portMAX_DELAY);
+    // Очередь заполнена больше чем наполовину - задачи пишут быстрее, чем кадры уходят на дисплей: ждём рендер
+    while (_listCount * 2 > _listCapacity || _listTextUsed * 2 > _listTextSize) {
+        xSemaphoreGive(_renderMutex);
+        xTaskNotifyGive(_renderTaskHandle);
+        vTaskDelay(1);
+        xSemaphoreTake(_renderMutex, portMAX_DELAY);
+    }
+    // Порция дописывается в конец очереди: кадры, ещё не нарисованные задачей рендера, сохраняются
+    _frameItems = _listCount;
+    _frameSegments = _listSegmentCount;
+    _frameText = _listTextUsed;
+    _listOverflow = false;
+    _listRecording = true;
+}
+
+void SavaOLED_ESP32::frameEnd() {
+    if (!_renderTaskHandle) {
+        display();
+        return;
+    }
+    _listRecording = false;
+    if (_listOverflow) {
+        // Часть порции не поместилась: отбрасывается вся, чтобы на экран не попал неполный кадр
+        _listCount = _frameItems;
+        _listSegmentCount = _frameSegments;
+        _listTextUsed = _frameText;
+        _renderDropped++;
+        OLED_WARN("frameEnd: command queue is full, frame dropped");
+    }
+    xSemaphoreGive(_renderMutex);
+    xTaskNotifyGive(_renderTaskHandle);
+}
+
+uint32_t SavaOLED_ESP32::getRenderFrames() const {
+    return _renderFrames;
+}
+
+uint32_t SavaOLED_ESP32::getRenderDropped() const {
+    return _renderDropped;
+}
+
+bool SavaOLED_ESP32::commandQueue(uint16_t capacity, uint8_t widgets) {
+    if (_renderTaskHandle) {
+        OLED_ERROR("commandQueue: stop renderTask before resizing the queue");
+        return false;
+    }
+    if (capacity == 0) {
+        _queueSlots.reset();
+        _queueBoxes.reset();
+        _queueMask = 0;
+        _queueWidgets = 0;
+        return true;
+    }
+    if (_stripPages) {
+        OLED_ERROR("commandQueue: not available in pageMode");
+        return false;
+    }
+    uint32_t size = 1;
+    while (size < capacity) size <<= 1;
+    if (size > 0x8000) size = 0x8000;
+    _queueSlots = std::make_unique<CommandSlot[]>(size);
+    for (uint32_t i = 0; i < size; i++) _queueSlots[i].seq.store(i, std::memory_order_relaxed);
+    _queueMask = size - 1;
+    _queueBoxes.reset();
+    if (widgets) {
+        _queueBoxes = std::make_unique<CommandBox[]>(widgets);
+        for (uint8_t i = 0; i < widgets; i++) {
+            _queueBoxes[i].seq.store(0, std::memory_order_relaxed);
+            _queueBoxes[i].pending.store(false, std::memory_order_relaxed);
         }
     }
+    _queueWidgets = widgets;
+    _queueHead.store(0, std::memory_order_relaxed);
+    _queueTail.store(0, std::memory_order_relaxed);
+    _queueDropped.store(0, std::memory_order_relaxed);
+    _queueCoalesced.store(0, std::memory_order_relaxed);
+    _queuePeak = 0;
+    return true;
+}
+
+bool SavaOLED_ESP32::post(const SavaCommand &cmd) {
+    if (!_queueSlots) return false;
+    if (cmd.widget == 0 || cmd.widget > _queueWidgets) {
+        if (!_pushCommand(cmd)) return false;
+        if (_renderTaskHandle) _wakeRender();
+        return true;
+    }
+
+    // Команда виджета пишется в его ячейку; в кольцо идёт только отметка, если её там ещё нет
+    CommandBox &box = _queueBoxes[cmd.widget - 1];
+    uint32_t seq = box.seq.load(std::memory_order_relaxed);
+    if ((seq & 1) || !box.seq.compare_exchange_strong(seq, seq + 1, std::memory_order_acquire)) {
+        // Ячейку в этот момент пишет другая задача (или задача, прерванная этим ISR): остаётся её значение, ждать нельзя
+        _queueCoalesced.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    // Барьер seqlock: читатель, увидевший хоть одно новое слово, после своего acquire-барьера увидит и нечётный seq
+    std::atomic_thread_fence(std::memory_order_release);
+    uint32_t words[CommandBox::WORDS] = { 0 };
+    memcpy(words, &cmd, sizeof(SavaCommand));
+    for (uint8_t i = 0; i < CommandBox::WORDS; i++) box.words[i].store(words[i], std::memory_order_relaxed);
+    // seq_cst для seq и pending: снятие отметки при отрисовке и чтение ячейки упорядочены с этой записью
+    box.seq.store(seq + 2, std::memory_order_seq_cst);
+    if (box.pending.exchange(true, std::memory_order_seq_cst)) {
+        _queueCoalesced.fetch_add(1, std::memory_order_relaxed); // прежняя команда ещё не нарисована - заменена
+        return true;
+    }
+    SavaCommand mark = {};
+    mark.type = CMD_WIDGET;
+    mark.widget = cmd.widget;
+    if (!_pushCommand(mark)) {
+        box.pending.store(false, std::memory_order_release);
+        return false;
+    }
+    if (_renderTaskHandle) _wakeRender();
+    return true;
+}
+
+bool SavaOLED_ESP32::_pushCommand(const SavaCommand &cmd) {
+    // Кольцо с номером записи в каждом слоте: позиция занимается CAS, команда публикуется записью seq.
+    // Ни блокировок, ни вызовов FreeRTOS до публикации - безопасно из ISR и при вытеснении посреди записи
+    uint32_t pos = _queueHead.load(std::memory_order_relaxed);
+    CommandSlot* slot;
+    for (;;) {
+        slot = &_queueSlots[pos & _queueMask];
+        uint32_t seq = slot->seq.load(std::memory_order_acquire);
+        int32_t diff = (int32_t)(seq - pos);
+        if (diff == 0) {
+            if (_queueHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            _queueDropped.fetch_add(1, std::memory_order_relaxed); // слот ещё не нарисован - очередь полна
+            return false;
+        } else {
+            pos = _queueHead.load(std::memory_order_relaxed);
+        }
+    }
+    slot->cmd = cmd;
+    slot->seq.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool SavaOLED_ESP32::postText(uint8_t widget, int16_t x, int16_t y, int16_t w, int16_t h, const savaFont &font,
+                              const char* text, uint8_t align, uint8_t mode) {
+    SavaCommand cmd = {};
+    cmd.type = CMD_TEXT;
+    cmd.widget = widget;
+    cmd.mode = mode;
+    cmd.flags = align & 0x03;
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = w;
+    cmd.h = h;
+    cmd.ref = &font;
+    if (text) memcpy(cmd.text, text, utf8_clip(text, SAVA_CMD_TEXT - 1));
+    return post(cmd);
+}
+
+bool SavaOLED_ESP32::postNumber(uint8_t widget, int16_t x, int16_t y, int16_t w, int16_t h, const savaFont &font,
+                                float value, uint8_t decimals, uint8_t align, uint8_t mode) {
+    SavaCommand cmd = {};
+    cmd.type = CMD_NUMBER;
+    cmd.widget = widget;
+    cmd.mode = mode;
+    cmd.flags = (align & 0x03) | ((decimals > 15 ? 15 : decimals) << 4);
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = w;
+    cmd.h = h;
+    cmd.ref = &font;
+    cmd.value = value;
+    return post(cmd);
+}
+
+bool SavaOLED_ESP32::postRect(uint8_t widget, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t mode, bool fill) {
+    SavaCommand cmd = {};
+    cmd.type = CMD_RECT;
+    cmd.widget = widget;
+    cmd.mode = mode;
+    cmd.flags = fill;
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = w;
+    cmd.h = h;
+    return post(cmd);
+}
+
+bool SavaOLED_ESP32::postBitmap(uint8_t widget, int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint8_t mode) {
+    SavaCommand cmd = {};
+    cmd.type = CMD_BITMAP;
+    cmd.widget = widget;
+    cmd.mode = mode;
+    cmd.x = x;
+    cmd.y = y;
+    cmd.w = w;
+    cmd.h = h;
+    cmd.ref = bitmap;
+    return post(cmd);
+}
+
+uint16_t SavaOLED_ESP32::getQueueDepth() const {
+    return _queueHead.load(std::memory_order_relaxed) - _queueTail.load(std::memory_order_relaxed);
+}
+
+uint16_t SavaOLED_ESP32::getQueuePeak() const {
+    return _queuePeak;
+}
+
+uint32_t SavaOLED_ESP32::getQueueDropped() const {
+    return _queueDropped.load(std::memory_order_relaxed);
+}
+
+uint32_t SavaOLED_ESP32::getQueueCoalesced() const {
+    return _queueCoalesced.load(std::memory_order_relaxed);
+}
+
+bool SavaOLED_ESP32::rasterCores(uint8_t cores, uint8_t helperCore, uint8_t priority, uint32_t stackBytes) {
+    bool enable = (cores >= 2);
+    if (enable == (_rasterTaskHandle != nullptr)) return true;
+    if (_renderTaskHandle) {
+        OLED_ERROR("rasterCores: call before renderTask");
+        return false;
+    }
+    if (!enable) {
+        _rasterStop = true;
+        xTaskNotifyGive(_rasterTaskHandle);
+        xSemaphoreTake(_rasterDone, portMAX_DELAY);
+        _rasterTaskHandle = nullptr;
+        _rasterHelper.reset();
+        _rasterSplit = 0;
+        return true;
+    }
+    if (_height < 16) {
+        OLED_WARN("rasterCores: canvas has a single page, nothing to split");
+        return false;
+    }
+    if (!_rasterDone) _rasterDone = xSemaphoreCreateBinary();
+    if (!_rasterDone) {
+        OLED_ERROR("rasterCores: failed to create semaphore");
+        return false;
+    }
+    // Второй растеризатор - тот же класс без I2C и без кадровых буферов, со своим буфером строки (8 КБ);
+    // рисует прямо в кадр основного. Конструктор закрытый, поэтому new вместо make_unique
+    _rasterHelper = std::unique_ptr<SavaOLED_ESP32>(new SavaOLED_ESP32(_width, _height, _port, 0, false));
+    _rasterHelper->glyphCache(_glyphPoolSize ? _glyphPoolSize + GLYPH_CACHE_SLOTS * sizeof(GlyphCacheEntry) : 0);
+    _rasterStop = false;
+    if (xTaskCreatePinnedToCore(_rasterTaskEntry, "SavaOLED_rast", stackBytes, this, priority,
+                                &_rasterTaskHandle, helperCore) != pdPASS) {
+        _rasterTaskHandle = nullptr;
+        _rasterHelper.reset();
+        OLED_ERROR("rasterCores: failed to create task");
+        return false;
+    }
+    OLED_LOG("Raster helper started on core %u", helperCore);
+    return true;
+}
+
+uint8_t SavaOLED_ESP32::getRasterSplit() const {
+    return _rasterSplit;
+}
+
+bool SavaOLED_ESP32::canvas(SavaCanvas &canvas, uint8_t width, uint8_t height) {
+    if (&canvas == _canvasTarget) {
+        OLED_ERROR("canvas: canvas is the current draw target");
+        return false;
+    }
+    uint8_t pages = (height + 7) / 8;
+    if (width == 0 || pages == 0 || pages > 31) {
+        OLED_ERROR("canvas: unsupported size %ux%u", width, height);
+        return false;
+    }
+    canvas.buffer = std::make_unique<uint8_t[]>(pages * width);
+    memset(canvas.buffer.get(), 0, pages * width);
+    canvas.width = width;
+    canvas.height = pages * 8;
+    return true;
+}
+
+void SavaOLED_ESP32::canvasBegin(SavaCanvas &canvas) {
+    if (!canvas.buffer) {
+        OLED_ERROR("canvasBegin: canvas is not allocated (call canvas first)");
+        return;
+    }
+    if (_listRecording || _renderTaskHandle) {
+        OLED_ERROR("canvasBegin: not available while recording a list or with renderTask");
+        return;
+    }
+    if (!_canvasTarget) {
+        _screenWidth = _width;
+        _screenHeight = _height;
+        _screenPage0 = _bufferPage0;
+        _screenPages = _bufferPages;
+    }
+    // Цель и размер подменяются целиком: примитивы и текст отсекаются по холсту, как по экрану
+    _canvasTarget = &canvas;
+    _target = canvas.buffer.get();
+    _width = canvas.width;
+    _height = canvas.height;
+    _bufferPage0 = 0;
+    _bufferPages = canvas.height / 8;
+    _resetClip();
+    _lineChanged = true;
+}
+
+void SavaOLED_ESP32::canvasEnd() {
+    if (!_canvasTarget) return;
+    _canvasTarget = nullptr;
+    _target = _buffer.get();
+    _width = _screenWidth;
+    _height = _screenHeight;
+    _bufferPage0 = _screenPage0;
+    _bufferPages = _screenPages;
+    _resetClip();
+    _lineChanged = true;
+}
+
+bool SavaOLED_ESP32::layers(uint8_t count) {
+    if (count > SAVA_MAX_LAYERS) {
+        OLED_ERROR("layers: %u layers requested, maximum is %u", count, SAVA_MAX_LAYERS);
+        return false;
+    }
+    if (count && (_stripPages || _canvasTurn != ROT_0 || _renderTaskHandle)) {
+        OLED_ERROR("layers: not available in pageMode, with canvasRotation or renderTask");
+        return false;
+    }
+    if (_canvasTarget) {
+        OLED_ERROR("layers: call layerEnd / canvasEnd first");
+        return false;
+    }
+    _layers.reset();
+    _layerCount = 0;
+    _layerDirty = 0;
+    _overlayDepth = 0; // Кадр собирается из слоёв заново - сохранённые области недействительны
+    _overlayUsed = 0;
+    if (count == 0) return true;
+
+    std::unique_ptr<SavaLayer[]> created = std::make_unique<SavaLayer[]>(count);
+    for (uint8_t i = 0; i < count; i++) {
+        if (!canvas(created[i].canvas, _width, _height)) return false;
+    }
+    created[0].mode = REPLACE;
+    _layers = std::move(created);
+    _layerCount = count;
+    _markLayerRows(0, _height);
+    return true;
+}
+
+void SavaOLED_ESP32::layerBegin(uint8_t layer, int16_t y, int16_t h) {
+    if (layer >= _layerCount) {
+        OLED_ERROR("layerBegin: layer %u does not exist (layers: %u)", layer, _layerCount);
+        return;
+    }
+    if (_canvasTarget) {
+        OLED_ERROR("layerBegin: call layerEnd / canvasEnd first");
+        return;
+    }
+    canvasBegin(_layers[layer].canvas);
+    if (_canvasTarget != &_layers[layer].canvas) return;
+
+    // Окно отсечения - объявленные строки: рисование за ними не изменит несобранные страницы
+    int16_t y1 = (h > 0) ? y + h : _height;
+    if (y < 0) y = 0;
+    if (y1 > _height) y1 = _height;
+    if (y1 < y) y1 = y;
+    _clipY0 = y;
+    _clipY1 = y1;
+    if (_layers[layer].visible) _markLayerRows(y, y1);
+}
+
+void SavaOLED_ESP32::layerEnd() {
+    canvasEnd();
+}
+
+void SavaOLED_ESP32::layerMode(uint8_t layer, uint8_t mode) {
+    if (layer >= _layerCount) {
+        OLED_ERROR("layerMode: layer %u does not exist (layers: %u)", layer, _layerCount);
+        return;
+    }
+    if (mode != REPLACE && mode != ADD_UP && mode != INV_AUTO && mode != ERASE) {
+        OLED_WARN("layerMode: unsupported mode %u", mode);
+        return;
+    }
+    if (_layers[layer].mode == mode) return;
+    _layers[layer].mode = mode;
+    if (_layers[layer].visible) _markLayerRows(0, _layers[0].canvas.height);
+}
+
+void SavaOLED_ESP32::layerVisible(uint8_t layer, bool visible) {
+    if (layer >= _layerCount) {
+        OLED_ERROR("layerVisible: layer %u does not exist (layers: %u)", layer, _layerCount);
+        return;
+    }
+    if (_layers[layer].visible == visible) return;
+    _layers[layer].visible = visible;
+    _markLayerRows(0, _layers[0].canvas.height);
+}
+
+uint8_t SavaOLED_ESP32::getLayerCount() const {
+    return _layerCount;
+}
+
+uint8_t SavaOLED_ESP32::getComposedPages() const {
+    return _composedPages;
+}
+
+bool SavaOLED_ESP32::overlayPool(uint16_t bytes, uint8_t depth) {
+    _overlayDepth = 0;
+    _overlayUsed = 0;
+    if (bytes == 0 || depth == 0) {
+        _overlayPool.reset();
+        _overlaySaves.reset();
+        _overlayBytes = 0;
+        _overlayMax = 0;
+        return true;
+    }
+    _overlayPool = std::make_unique<uint8_t[]>(bytes);
+    _overlaySaves = std::make_unique<OverlaySave[]>(depth);
+    _overlayBytes = bytes;
+    _overlayMax = depth;
+    return true;
+}
+
+bool SavaOLED_ESP32::pushOverlay(int16_t x, int16_t y, int16_t w, int16_t h) {
+    if (!_overlayPool) {
+        OLED_WARN("pushOverlay: overlay pool is not allocated (call overlayPool first)");
+        return false;
+    }
+    if (_stripPages || _renderTaskHandle || _layerCount) {
+        OLED_ERROR("pushOverlay: not available in pageMode, with renderTask or layers");
+        return false;
+    }
+    if (_canvasTarget) {
+        OLED_ERROR("pushOverlay: call canvasEnd first");
+        return false;
+    }
+    // Сохраняются целые страницы: восстановление - байт в байт, без масок строк
+    int16_t x0 = (x > 0) ? x : 0;
+    int16_t x1 = (x + w < _width) ? (x + w) : _width;
+    int16_t y0 = (y > 0) ? y : 0;
+    int16_t y1 = (y + h < _height) ? (y + h) : _height;
+    OverlaySave save = { _overlayUsed, x0, 0, 0, 0 };
+    if (x0 < x1 && y0 < y1) {
+        save.width = x1 - x0;
+        save.page0 = y0 >> 3;
+        save.pages = ((y1 - 1) >> 3) - save.page0 + 1;
+    }
+    uint16_t size = save.width * save.pages;
+    if (_overlayDepth >= _overlayMax || (uint32_t)_overlayUsed + size > _overlayBytes) {
+        _overlayOverflows++;
+        OLED_WARN("pushOverlay: pool overflow (%u + %u of %u bytes, depth %u of %u)",
+                  _overlayUsed, size, _overlayBytes, _overlayDepth, _overlayMax);
+        return false;
+    }
+    uint8_t* dest = _overlayPool.get() + save.offset;
+    for (uint8_t p = 0; p < save.pages; p++) {
+        memcpy(dest + p * save.width, _buffer.get() + (save.page0 + p) * _width + save.x0, save.width);
+    }
+    _overlaySaves[_overlayDepth++] = save;
+    _overlayUsed += size;
+    return true;
+}
+
+bool SavaOLED_ESP32::popOverlay(bool transmit) {
+    if (_stripPages || _renderTaskHandle || _layerCount) {
+        OLED_ERROR("popOverlay: not available in pageMode, with renderTask or layers");
+        return false;
+    }
+    if (_canvasTarget) {
+        OLED_ERROR("popOverlay: call canvasEnd first");
+        return false;
+    }
+    if (_overlayDepth == 0) {
+        OLED_WARN("popOverlay: no overlay to restore");
+        return false;
+    }
+    const OverlaySave &save = _overlaySaves[--_overlayDepth];
+    const uint8_t* src = _overlayPool.get() + save.offset;
+    for (uint8_t p = 0; p < save.pages; p++) {
+        memcpy(_buffer.get() + (save.page0 + p) * _width + save.x0, src + p * save.width, save.width);
+    }
+    _overlayUsed = save.offset;
+    if (!transmit || save.pages == 0) return true;
+    // Отправляется только восстановленное окно; повёрнутый холст ложится на панель иначе - тогда весь кадр
+    if (_canvasTurn == ROT_0) {
+        _sendStrip(save.page0, save.pages, save.x0, save.x0 + save.width);
+    } else {
+        display();
+    }
+    return true;
+}
+
+uint8_t SavaOLED_ESP32::getOverlayDepth() const {
+    return _overlayDepth;
+}
+
+uint16_t SavaOLED_ESP32::getOverlayUsed() const {
+    return _overlayUsed;
+}
+
+uint32_t SavaOLED_ESP32::getOverlayOverflows() const {
+    return _overlayOverflows;
 }
 
 void SavaOLED_ESP32::fillScreen(uint8_t pattern) {
-    // Используем memset для быстрой заливки всего массива одним байтом
-    // _buffer.get() используется, так как у нас std::unique_ptr
-    memset(_buffer.get(), pattern, _bufferSize);
+    if (_renderTaskHandle) {
+        OLED_ERROR("fillScreen: not available with renderTask (use clear() inside frameBegin / frameEnd)");
+        return;
+    }
+    _fillClip(pattern);
 }
 
 
@@ -851,18 +2650,50 @@ void SavaOLED_ESP32::display() {
         OLED_WARN("display() called but OLED not initialized");
         return;
     }
+    if (_canvasTarget) {
+        OLED_WARN("display() called while drawing to a canvas (call canvasEnd first)");
+        return;
+    }
+
+    if (_renderTaskHandle) {
+        // Кадр отправляет задача рендера; из других задач display() её только будит
+        xTaskNotifyGive(_renderTaskHandle);
+        return;
+    }
+    // Кадр из слоёв собирается до очереди: команды post() ложатся поверх
+    if (_layerCount) _composeLayers();
+    _drainCommands();
+
+    if (_stripPages) {
+        // Кадрового буфера нет: весь кадр собирается из последнего списка полосами
+        const int16_t full[1][4] = { { 0, 0, _width, _height } };
+        _listReplay(full, 1);
+        return;
+    }
 
+    const uint8_t* frame = _panelFrame();
     if (_Buffer) {
-        _displayFullBuffer();
+        _displayFullBuffer(frame);
     } else {
-        _displayPaged();
+        _displayPaged(frame);
     }
 }
 
 
 void SavaOLED_ESP32::clear() {
+    if (_listRecording) {
+        // Список сам очищает изменённые области; в очереди renderTask очистка - обычная команда
+        if (_renderTaskHandle) rect(0, 0, _width, _height, ERASE, FILL);
+        return;
+    }
+    if (_layerCount && !_canvasTarget) {
+        // Со слоями очищенный кадр - это кадр, собранный из слоёв целиком
+        _markLayerRows(0, _height);
+        _composeLayers();
+        return;
+    }
     // Возвращаем на очистку нулями, чтобы видеть результат, а не белый экран
-    memset(_buffer.get(), 0x00, _bufferSize);
+    _fillClip(0x00);
 }
 
 //****************************************************************************************
@@ -870,10 +2701,21 @@ void SavaOLED_ESP32::clear() {
 //****************************************************************************************
 
 void SavaOLED_ESP32::dot(int16_t x, int16_t y, uint8_t mode) {
+    if (_listRecording) {
+        DisplayListItem* item = _listAdd(DL_DOT, mode, x, y, x + 1, y + 1);
+        if (item) { item->p[0] = x; item->p[1] = y; }
+        return;
+    }
     _drawPixel(x, y, mode);
 }
 
 void SavaOLED_ESP32::line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t mode) {
+    if (_listRecording) {
+        DisplayListItem* item = _listAdd(DL_LINE, mode, (x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2,
+                                         ((x1 > x2) ? x1 : x2) + 1, ((y1 > y2) ? y1 : y2) + 1);
+        if (item) { item->p[0] = x1; item->p[1] = y1; item->p[2] = x2; item->p[3] = y2; }
+        return;
+    }
     int16_t dx = abs(x2 - x1);
     int16_t dy = -abs(y2 - y1);
     int16_t sx = x1 < x2 ? 1 : -1;
@@ -897,19 +2739,49 @@ void SavaOLED_ESP32::line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_
 }
 
 void SavaOLED_ESP32::hLine(int16_t x, int16_t y, int16_t w, uint8_t mode) {
-    for (int16_t i = x; i < x + w; i++) {
-        _drawPixel(i, y, mode);
+    if (_listRecording) { rect(x, y, w, 1, mode, FILL); return; } // те же пиксели, что и у линии
+    // Отсечение сразу для всей линии (в постраничном режиме большая часть линий вне полосы)
+    if (y < _clipY0 || y >= _clipY1) return;
+    int32_t x_start = (x > _clipX0) ? x : _clipX0;
+    int32_t x_end = ((int32_t)x + w < _clipX1) ? (int32_t)x + w : _clipX1;
+    uint8_t* row = _pageRow(y >> 3);
+    uint8_t bit = 1 << (y & 7);
+    switch (mode) {
+        case ERASE_BORDER:
+        case ADD_UP:
+        case REPLACE:  for (int32_t i = x_start; i < x_end; i++) row[i] |= bit; break;
+        case INV_AUTO: for (int32_t i = x_start; i < x_end; i++) row[i] ^= bit; break;
+        case ERASE:    for (int32_t i = x_start; i < x_end; i++) row[i] &= ~bit; break;
     }
 }
 
 void SavaOLED_ESP32::vLine(int16_t x, int16_t y, int16_t h, uint8_t mode) {
-    for (int16_t i = y; i < y + h; i++) {
-        _drawPixel(x, i, mode);
+    if (_listRecording) { rect(x, y, 1, h, mode, FILL); return; }
+    if (x < _clipX0 || x >= _clipX1) return;
+    int32_t y_start = (y > _clipY0) ? y : _clipY0;
+    int32_t y_end = ((int32_t)y + h < _clipY1) ? (int32_t)y + h : _clipY1;
+    if (y_start >= y_end) return;
+    // Одна запись по маске на страницу
+    for (int32_t page_y = y_start & ~7; page_y < y_end; page_y += 8) {
+        uint8_t mask = page_rows_mask(page_y >> 3, y_start, y_end);
+        uint8_t &dest = _pageRow(page_y >> 3)[x];
+        switch (mode) {
+            case ERASE_BORDER:
+            case ADD_UP:
+            case REPLACE:  dest |= mask; break;
+            case INV_AUTO: dest ^= mask; break;
+            case ERASE:    dest &= ~mask; break;
+        }
     }
 }
 
 void SavaOLED_ESP32::circle(int16_t x0, int16_t y0, int16_t r, uint8_t mode, bool fill) {
     if (r < 0) return;
+    if (_listRecording) {
+        DisplayListItem* item = _listAdd(DL_CIRCLE, mode, x0 - r, y0 - r, x0 + r + 1, y0 + r + 1);
+        if (item) { item->flags = fill; item->p[0] = x0; item->p[1] = y0; item->p[2] = r; }
+        return;
+    }
 	// --- СПЕЦ-РЕЖИМ: Очистка фона + Белая рамка ---
 	if (mode == ERASE_BORDER && fill) {
         circle(x0, y0, r, ERASE, true);    // Шаг 1: Стираем круг (черный блин)
@@ -1005,16 +2877,19 @@ void SavaOLED_ESP32::circle(int16_t x0, int16_t y0, int16_t r, uint8_t mode, boo
 
 void SavaOLED_ESP32::rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t mode, bool fill) {
     if (w <= 0 || h <= 0) return;
-	if (mode == ERASE_BORDER && fill) {
+    if (_listRecording) {
+        DisplayListItem* item = _listAdd(DL_RECT, mode, x, y, x + w, y + h);
+        if (item) { item->flags = fill; item->p[0] = x; item->p[1] = y; item->p[2] = w; item->p[3] = h; }
+        return;
+    }
+	if (mode == ERASE_BORDER && fill) {
         rect(x, y, w, h, ERASE, true);    // Шаг 1: Стираем всё внутри (черный прямоугольник)
         rect(x, y, w, h, ADD_UP, false);  // Шаг 2: Рисуем белую рамку поверх
         return;
     }
     if (fill) {
-        // Заливка: просто рисуем стопку горизонтальных линий
-        for (int16_t i = y; i < y + h; i++) {
-            hLine(x, i, w, mode);
-        }
+        // Заливка: по маске строк на каждую страницу, а не построчно
+        _fillRect(x, y, w, h, mode);
     } else {
         // Контур: 4 линии
         hLine(x+1, y, w - 2, mode);          // Верхняя
@@ -1026,6 +2901,11 @@ void SavaOLED_ESP32::rect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t mo
 
 void SavaOLED_ESP32::rectR(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint8_t mode, bool fill) {
     if (w <= 0 || h <= 0) return;
+    if (_listRecording) {
+        DisplayListItem* item = _listAdd(DL_RECT_R, mode, x, y, x + w, y + h);
+        if (item) { item->flags = fill; item->p[0] = x; item->p[1] = y; item->p[2] = w; item->p[3] = h; item->p[4] = r; }
+        return;
+    }
     if (r < 0) r = 0;
     if (r > w / 2) r = w / 2;
     if (r > h / 2) r = h / 2;
@@ -1086,21 +2966,129 @@ void SavaOLED_ESP32::rectR(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r
     }
 }
 
+void SavaOLED_ESP32::invertRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+    rect(x, y, w, h, INV_AUTO, FILL);
+}
+
+void SavaOLED_ESP32::clearRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+    rect(x, y, w, h, ERASE, FILL);
+}
+
+void SavaOLED_ESP32::copyRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t toX, int16_t toY) {
+    if (w <= 0 || h <= 0) return;
+    if (_listRecording || _renderTaskHandle) {
+        // Результат зависит от прежнего содержимого кадра - в список или очередь такую команду не записать
+        OLED_ERROR("copyRect: not available while recording a list or with renderTask");
+        return;
+    }
+    if (_stripPages && !_canvasTarget) {
+        OLED_ERROR("copyRect: not available in pageMode");
+        return;
+    }
+    // Источник - только внутри холста, приёмник - только внутри окна отсечения
+    const int16_t dx = toX - x, dy = toY - y;
+    int16_t x_start = (x > 0) ? x : 0;
+    int16_t x_end = (x + w < _width) ? (x + w) : _width;
+    int16_t y_start = (y > 0) ? y : 0;
+    int16_t y_end = (y + h < _height) ? (y + h) : _height;
+    x_start = (x_start + dx > _clipX0) ? (x_start + dx) : _clipX0;
+    x_end = (x_end + dx < _clipX1) ? (x_end + dx) : _clipX1;
+    y_start = (y_start + dy > _clipY0) ? (y_start + dy) : _clipY0;
+    y_end = (y_end + dy < _clipY1) ? (y_end + dy) : _clipY1;
+    if (x_start >= x_end || y_start >= y_end || (dx == 0 && dy == 0)) return;
+
+    // Как drawCanvas, где холст - сама цель со смещением (dx, dy). Страницы обходятся так, чтобы источник
+    // читался раньше, чем его перезапишут: при сдвиге вниз - снизу вверх, иначе - сверху вниз.
+    // Если источник - та же страница со сдвигом по колонкам, его строка сначала копируется во временный буфер.
+    const int16_t page_y = dy >> 3;
+    const uint8_t shift = dy & 7;
+    const uint16_t count = x_end - x_start;
+    const int16_t first = y_start >> 3, last = (y_end - 1) >> 3;
+    const int16_t step = (dy > 0) ? -1 : 1;
+    uint8_t lo_row[256], hi_row[256];
+    for (int16_t page = (dy > 0) ? last : first; page >= first && page <= last; page += step) {
+        uint8_t cover = page_rows_mask(page, y_start, y_end);
+        uint8_t* dest = _pageRow(page) + x_start;
+        int16_t k = page - page_y;
+        bool has_lo = (k >= 0 && k < _bufferPages);
+        bool has_hi = (shift && k - 1 >= 0 && k - 1 < _bufferPages);
+        if (!shift && cover == 0xFF) {
+            // Целые байты: сдвиг страницы на целое число страниц
+            memmove(dest, _pageRow(k) + x_start - dx, count);
+            continue;
+        }
+        const uint8_t* lo = has_lo ? _pageRow(k) + x_start - dx : nullptr;
+        const uint8_t* hi = has_hi ? _pageRow(k - 1) + x_start - dx : nullptr;
+        if (dx != 0 && (k == page || k - 1 == page)) {
+            // Та же страница со сдвигом по колонкам: запись обогнала бы чтение
+            if (lo) lo = (const uint8_t*)memcpy(lo_row, lo, count);
+            if (hi) hi = (const uint8_t*)memcpy(hi_row, hi, count);
+        }
+        blit_row(dest, lo, hi, shift, cover, count, REPLACE);
+    }
+}
+
+void SavaOLED_ESP32::scrollRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dx, int16_t dy) {
+    if (w <= 0 || h <= 0 || (dx == 0 && dy == 0)) return;
+    if (_listRecording || _renderTaskHandle) {
+        OLED_ERROR("scrollRect: not available while recording a list or with renderTask");
+        return;
+    }
+    if (_stripPages && !_canvasTarget) {
+        OLED_ERROR("scrollRect: not available in pageMode");
+        return;
+    }
+    // Область за краем холста не хранится: сдвигается только видимая часть
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > _width) w = _width - x;
+    if (y + h > _height) h = _height - y;
+    if (w <= 0 || h <= 0) return;
+    // Копия и очистка - внутри области: окно отсечения сужается до неё на время сдвига
+    int16_t clip_x0 = _clipX0, clip_y0 = _clipY0, clip_x1 = _clipX1, clip_y1 = _clipY1;
+    if (x > _clipX0) _clipX0 = x;
+    if (y > _clipY0) _clipY0 = y;
+    if (x + w < _clipX1) _clipX1 = x + w;
+    if (y + h < _clipY1) _clipY1 = y + h;
+    if (_clipX0 < _clipX1 && _clipY0 < _clipY1) {
+        copyRect(x, y, w, h, x + dx, y + dy);
+        // Освободившиеся колонки и строки
+        if (dx > 0) _fillRect(x, y, dx, h, ERASE);
+        if (dx < 0) _fillRect(x + w + dx, y, -dx, h, ERASE);
+        if (dy > 0) _fillRect(x, y, w, dy, ERASE);
+        if (dy < 0) _fillRect(x, y + h + dy, w, -dy, ERASE);
+    }
+    _clipX0 = clip_x0;
+    _clipY0 = clip_y0;
+    _clipX1 = clip_x1;
+    _clipY1 = clip_y1;
+}
+
 
 void SavaOLED_ESP32::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint8_t mode) {
-    // Проверка, находится ли битмап полностью за пределами экрана
-    if ((x >= _width) || (y >= _height) || ((x + w) <= 0) || ((y + h) <= 0)) {
+    if (_listRecording) {
+        DisplayListItem* item = _listAdd(DL_BITMAP, mode, x, y, x + w, y + h);
+        if (item) { item->data = bitmap; item->p[0] = x; item->p[1] = y; item->p[2] = w; item->p[3] = h; }
+        return;
+    }
+    // Проверка, находится ли битмап полностью за пределами экрана (окна отсечения)
+    if ((x >= _clipX1) || (y >= _clipY1) || ((x + w) <= _clipX0) || ((y + h) <= _clipY0)) {
         return;
     }
 
-    for (int16_t j = 0; j < w; j++) {
-        for (int16_t i = 0; i < h; i++) {
+    // Только колонки и строки, попадающие в окно отсечения
+    int16_t j_start = (x < _clipX0) ? (_clipX0 - x) : 0;
+    int16_t j_end = (x + w > _clipX1) ? (_clipX1 - x) : w;
+    int16_t i_start = (y < _clipY0) ? (_clipY0 - y) : 0;
+    int16_t i_end = (y + h > _clipY1) ? (_clipY1 - y) : h;
+    for (int16_t j = j_start; j < j_end; j++) {
+        for (int16_t i = i_start; i < i_end; i++) {
             // Вычисляем абсолютные координаты пикселя на экране
             int16_t screen_x = x + j;
             int16_t screen_y = y + i;
 
             // ОБЯЗАТЕЛЬНО: Проверка границ перед ручной записью в буфер
-            if (screen_x < 0 || screen_x >= _width || screen_y < 0 || screen_y >= _height) continue;
+            if (screen_x < _clipX0 || screen_x >= _clipX1 || screen_y < _clipY0 || screen_y >= _clipY1) continue;
 
             // Получаем значение пикселя из битмапа (1 или 0)
             bool pixel_on = bitmap[ (i / 8) * w + j ] & (1 << (i % 8));
@@ -1114,15 +3102,96 @@ void SavaOLED_ESP32::drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int
                 // А в REPLACE ноль должен СТИРАТЬ фон.
                 if (mode == REPLACE) {
                     // Ручное стирание пикселя (установка в 0)
-                    _buffer.get()[screen_x + (screen_y / 8) * _width] &= ~(1 << (screen_y % 8));
+                    _pageRow(screen_y >> 3)[screen_x] &= ~(1 << (screen_y & 7));
+                }
+            }
+        }
+    }
+
+}
+
+void SavaOLED_ESP32::drawBitmapRLE(int16_t x, int16_t y, const uint8_t* data, int16_t w, int16_t h, uint8_t mode) {
+    if (_listRecording) {
+        DisplayListItem* item = _listAdd(DL_BITMAP_RLE, mode, x, y, x + w, y + h);
+        if (item) { item->data = data; item->p[0] = x; item->p[1] = y; item->p[2] = w; item->p[3] = h; }
+        return;
+    }
+    if ((x >= _clipX1) || (y >= _clipY1) || ((x + w) <= _clipX0) || ((y + h) <= _clipY0)) {
+        return;
+    }
+
+    // Поток разворачивается страница за страницей: [страница 0: колонки 0..w-1] [страница 1] ...
+    RleStream stream(data);
+    int16_t bitmap_pages = (h + 7) / 8;
+    for (int16_t page = 0; page < bitmap_pages; page++) {
+        for (int16_t j = 0; j < w; j++) {
+            uint8_t column_bits = stream.next();
+            int16_t screen_x = x + j;
+            if (screen_x < _clipX0 || screen_x >= _clipX1) continue;
+
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                int16_t i = page * 8 + bit;
+                if (i >= h) break;
+                int16_t screen_y = y + i;
+                if (screen_y < _clipY0 || screen_y >= _clipY1) continue;
+
+                if (column_bits & (1 << bit)) {
+                    _drawPixel(screen_x, screen_y, mode);
+                } else if (mode == REPLACE) {
+                    _pageRow(screen_y >> 3)[screen_x] &= ~(1 << (screen_y & 7));
                 }
             }
         }
     }
+}
 
+void SavaOLED_ESP32::drawCanvas(const SavaCanvas &canvas, int16_t x, int16_t y, uint8_t mode) {
+    if (!canvas.buffer) return;
+    if (_listRecording) {
+        DisplayListItem* item = _listAdd(DL_CANVAS, mode, x, y, x + canvas.width, y + canvas.height);
+        if (item) { item->data = (const uint8_t*)&canvas; item->p[0] = x; item->p[1] = y; item->p[2] = canvas.width; item->p[3] = canvas.height; }
+        return;
+    }
+    if (canvas.buffer.get() == _target) {
+        OLED_ERROR("drawCanvas: canvas cannot be drawn onto itself");
+        return;
+    }
+    // Колонки и строки, попадающие в окно отсечения
+    int16_t x_start = (x > _clipX0) ? x : _clipX0;
+    int16_t x_end = (x + canvas.width < _clipX1) ? (x + canvas.width) : _clipX1;
+    int16_t y_start = (y > _clipY0) ? y : _clipY0;
+    int16_t y_end = (y + canvas.height < _clipY1) ? (y + canvas.height) : _clipY1;
+    if (x_start >= x_end || y_start >= y_end) return;
+
+    // Страница холста k ложится на страницы экрана page_y + k (сдвиг влево) и page_y + k + 1 (остаток)
+    const int16_t page_y = y >> 3; // с округлением вниз (верно и для y < 0)
+    const uint8_t shift = y & 7;
+    const int16_t canvas_pages = canvas.height / 8;
+    const uint16_t count = x_end - x_start;
+    for (int16_t page = y_start >> 3; page <= (y_end - 1) >> 3; page++) {
+        uint8_t cover = page_rows_mask(page, y_start, y_end);
+        int16_t k = page - page_y;
+        const uint8_t* lo = (k < canvas_pages) ? canvas.buffer.get() + k * canvas.width + (x_start - x) : nullptr;
+        const uint8_t* hi = (shift && k > 0) ? canvas.buffer.get() + (k - 1) * canvas.width + (x_start - x) : nullptr;
+        blit_row(_pageRow(page) + x_start, lo, hi, shift, cover, count, mode);
+    }
 }
 
 void SavaOLED_ESP32::bezier(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t mode) {
+    if (_listRecording) {
+        // Кривая лежит внутри треугольника опорных точек (+1 пиксель на округление)
+        int16_t min_x = (x0 < x1) ? x0 : x1;
+        int16_t max_x = (x0 > x1) ? x0 : x1;
+        int16_t min_y = (y0 < y1) ? y0 : y1;
+        int16_t max_y = (y0 > y1) ? y0 : y1;
+        if (x2 < min_x) min_x = x2;
+        if (x2 > max_x) max_x = x2;
+        if (y2 < min_y) min_y = y2;
+        if (y2 > max_y) max_y = y2;
+        DisplayListItem* item = _listAdd(DL_BEZIER, mode, min_x - 1, min_y - 1, max_x + 2, max_y + 2);
+        if (item) { item->p[0] = x0; item->p[1] = y0; item->p[2] = x1; item->p[3] = y1; item->p[4] = x2; item->p[5] = y2; }
+        return;
+    }
     // Определяем количество шагов для отрисовки.
     // Хорошая аппроксимация - половина периметра "огибающего" полигона.
     int16_t steps = (abs(x1 - x0) + abs(y1 - y0) + abs(x2 - x1) + abs(y2 - y1));
@@ -1178,31 +3247,31 @@ void SavaOLED_ESP32::drawPeak(int16_t x0, int16_t y0, int16_t x_peak, int16_t y_
 //****************************************************************************************
 
 // Отправляем кадр по страницам (стабильнее чем одна большая транзакция)
-void SavaOLED_ESP32::_displayPaged() {
+void SavaOLED_ESP32::_displayPaged(const uint8_t* frame) {
     const uint8_t display_cmds[] = {
-        OLED_COLUMN_ADDR, 0, (uint8_t)(_width - 1),
-        OLED_PAGE_ADDR, 0, (uint8_t)((_height / 8) - 1)
+        OLED_COLUMN_ADDR, 0, (uint8_t)(_panelWidth - 1),
+        OLED_PAGE_ADDR, 0, (uint8_t)((_panelHeight / 8) - 1)
     };
     _sendCommands(display_cmds, sizeof(display_cmds));
     if (!_dev_handle) {
         OLED_ERROR("_displayPaged: device not initialized");
         return;
     }
-    const uint8_t pages = _height / 8;
+    const uint8_t pages = _panelHeight / 8;
     for (uint8_t p = 0; p < pages; ++p) {
         _tx_buffer[0] = 0x40; // Управляющий байт для данных
-        memcpy(&_tx_buffer[1], &_buffer.get()[p * _width], _width);
-        esp_err_t ret = i2c_master_transmit(_dev_handle, _tx_buffer.get(), _width + 1, 500);
+        memcpy(&_tx_buffer[1], &frame[p * _panelWidth], _panelWidth);
+        esp_err_t ret = i2c_master_transmit(_dev_handle, _tx_buffer.get(), _panelWidth + 1, 500);
         if (ret != ESP_OK) {
             OLED_ERROR("Page %u transmit failed: %s (0x%X)", (unsigned)p, esp_err_to_name(ret), ret);
         }
     }
 }
 
-void SavaOLED_ESP32::_displayFullBuffer() { 
+void SavaOLED_ESP32::_displayFullBuffer(const uint8_t* frame) { 
     const uint8_t display_cmds[] = {  
-        OLED_COLUMN_ADDR, 0, (uint8_t)(_width - 1),  
-        OLED_PAGE_ADDR, 0, (uint8_t)((_height / 8) - 1)  
+        OLED_COLUMN_ADDR, 0, (uint8_t)(_panelWidth - 1),  
+        OLED_PAGE_ADDR, 0, (uint8_t)((_panelHeight / 8) - 1)  
     };  
     _sendCommands(display_cmds, sizeof(display_cmds));
     if (!_dev_handle) {
@@ -1210,13 +3279,44 @@ void SavaOLED_ESP32::_displayFullBuffer() {
         return;
     }  
     _tx_buffer[0] = 0x40; // Управляющий байт для данных  
-    memcpy(&_tx_buffer[1], _buffer.get(), _bufferSize);
+    memcpy(&_tx_buffer[1], frame, _bufferSize);
     esp_err_t ret = i2c_master_transmit(_dev_handle, _tx_buffer.get(), _bufferSize + 1, 1000);
     if (ret != ESP_OK) {
         OLED_ERROR("Full buffer transmit failed: %s (0x%X)", esp_err_to_name(ret), ret);
     }  
 }
 
+const uint8_t* SavaOLED_ESP32::_panelFrame() {
+    if (_canvasTurn == ROT_0) return _buffer.get();
+
+    // Холст _width x _height (страницы по 8 строк) -> панель _panelWidth x _panelHeight.
+    // Блок 8x8: 8 колонок холста одной страницы = 8 колонок панели одной страницы после транспонирования.
+    const uint8_t* src = _buffer.get();
+    uint8_t* dst = _rotBuffer.get();
+    const uint8_t blocks_x = _width / 8;
+    const uint8_t canvas_pages = _height / 8;
+    for (uint8_t lp = 0; lp < canvas_pages; lp++) {
+        for (uint8_t bx = 0; bx < blocks_x; bx++) {
+            const uint8_t* block = &src[bx * 8 + lp * _width];
+            uint64_t x = 0;
+            if (_canvasTurn == ROT_90) {
+                // x_панели = y, y_панели = _width - 1 - x: колонки блока в обратном порядке
+                for (uint8_t j = 0; j < 8; j++) x |= (uint64_t)block[j] << ((7 - j) * 8);
+                x = transpose8x8(x);
+                uint8_t* out = &dst[lp * 8 + (blocks_x - 1 - bx) * _panelWidth];
+                for (uint8_t b = 0; b < 8; b++) out[b] = (uint8_t)(x >> (b * 8));
+            } else {
+                // ROT_270: x_панели = _height - 1 - y, y_панели = x
+                for (uint8_t j = 0; j < 8; j++) x |= (uint64_t)block[j] << (j * 8);
+                x = transpose8x8(x);
+                uint8_t* out = &dst[(_height - 1 - lp * 8) + bx * _panelWidth];
+                for (uint8_t b = 0; b < 8; b++) *(out - b) = (uint8_t)(x >> (b * 8));
+            }
+        }
+    }
+    return dst;
+}
+
 void SavaOLED_ESP32::_sendCommands(const uint8_t* cmds, uint8_t len) {
     if (!_dev_handle) {
         OLED_ERROR("_sendCommands: device handle is NULL");
@@ -1242,9 +3342,120 @@ void SavaOLED_ESP32::_sendCommands(const uint8_t* cmds, uint8_t len) {
     }
 }
 
-uint16_t SavaOLED_ESP32::_getCharIndex(const savaFont* fontPtr, uint16_t char_code) {
+char* SavaOLED_ESP32::_reserveSegment(size_t len) {
+    if (_segmentCount >= MAX_SEGMENTS) {
+        OLED_ERROR("Segment overflow! Max %d segments per line", MAX_SEGMENTS);
+        return nullptr;
+    }
+    if (_textBufferPos + len + 1 > TEXT_BUFFER_SIZE) {
+        OLED_ERROR("Text buffer overflow! Pos: %zu, Need: %zu, Max: %zu",
+                   _textBufferPos, len, TEXT_BUFFER_SIZE);
+        return nullptr;
+    }
+    return &_textBuffer[_textBufferPos];
+}
+
+void SavaOLED_ESP32::_commitSegment(size_t len) {
+    // Сегмент указывает на только что записанный текст в общем буфере
+    _addSegment(&_textBuffer[_textBufferPos], len);
+
+    // Сдвигаем позицию в буфере
+    _textBufferPos += len; // Сдвигаем указатель на длину записанного текста
+    _textBuffer[_textBufferPos] = '\0'; // Ставим нуль-терминатор
+    _textBufferPos++; // Переходим на следующую позицию
+}
+
+void SavaOLED_ESP32::_addSegment(const char* text, size_t len) {
+    // Создаем и заполняем новый сегмент
+    _segments[_segmentCount].text = text;
+    _segments[_segmentCount].fontPtr = _currentFont;
+    _segments[_segmentCount].length = len;
+    _segments[_segmentCount].scale = _textScale;
+    _segments[_segmentCount].drawMode = _drawMode;
+    _segmentCount++;
+
+    _lineChanged = true;
+}
+
+void SavaOLED_ESP32::_commitNumber(uint16_t len, uint16_t max_len) {
+    // Длинный результат обрезается, как это делал snprintf в буфер фиксированного размера
+    if (len > max_len) len = max_len;
+    if (_textBufferPos + len + 1 > TEXT_BUFFER_SIZE) {
+        OLED_ERROR("Text buffer overflow! Pos: %zu, Need: %u, Max: %zu",
+                   _textBufferPos, len, TEXT_BUFFER_SIZE);
+        return;
+    }
+    _commitSegment(len);
+}
+
+uint16_t SavaOLED_ESP32::_emitInteger(char* dest, uint16_t cap, bool negative, uint32_t magnitude, uint8_t min_digits) {
+    // Эквивалент "%0<min_digits>ld": ширина включает знак, дополнение нулями после знака
+    uint8_t digits = count_digits(magnitude);
+    uint16_t core = negative + digits;
+    uint16_t len = (min_digits > core) ? min_digits : core;
+
+    // Цифры пишутся с конца; позиции за пределом cap отбрасываются
+    int16_t pos = len - 1;
+    for (uint8_t d = 0; d < digits; d++, pos--) {
+        if (pos < cap) dest[pos] = '0' + (magnitude % 10);
+        magnitude /= 10;
+    }
+    for (; pos >= negative; pos--) {
+        if (pos < cap) dest[pos] = '0';
+    }
+    if (negative && cap > 0) dest[0] = '-';
+    return len;
+}
+
+uint16_t SavaOLED_ESP32::_emitFloat(char* dest, uint16_t cap, float value, uint8_t decimals, uint8_t min_width) {
+    // float разбирается напрямую, без перехода через double
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    bool negative = (bits >> 31) != 0;
+    uint8_t exponent = (bits >> 23) & 0xFF;
+    uint32_t mantissa = bits & 0x7FFFFF;
+
+    if (exponent == 0xFF) return emit_special(dest, cap, mantissa ? "nan" : "inf", negative, min_width);
+    int16_t exp2 = (exponent == 0) ? -149 : (int16_t)(exponent - 150);
+    if (exponent != 0) mantissa |= 1UL << 23;
+    return emit_fixed(dest, cap, negative, mantissa, exp2, decimals, min_width);
+}
+
+uint16_t SavaOLED_ESP32::_emitDouble(char* dest, uint16_t cap, double value, uint8_t decimals, uint8_t min_width) {
+    // Разбираем double на мантиссу и порядок без плавающей арифметики (на ESP32 double — программный)
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    bool negative = (bits >> 63) != 0;
+    uint16_t exponent = (bits >> 52) & 0x7FF;
+    uint64_t mantissa = bits & 0xFFFFFFFFFFFFFULL;
+
+    if (exponent == 0x7FF) return emit_special(dest, cap, mantissa ? "nan" : "inf", negative, min_width);
+    int16_t exp2 = (exponent == 0) ? -1074 : (int16_t)(exponent - 1075);
+    if (exponent != 0) mantissa |= 1ULL << 52;
+    return emit_fixed(dest, cap, negative, mantissa, exp2, decimals, min_width);
+}
+
+#ifdef SAVAOLED_HAS_PRINTFMT
+void SavaOLED_ESP32::_fmtPut(char* dest, uint16_t cap, uint16_t &pos, const char* src, uint16_t len) {
+    if (pos < cap) memcpy(dest + pos, src, (cap - pos < len) ? (cap - pos) : len);
+    pos += len;
+}
+#endif
+
+uint16_t SavaOLED_ESP32::_getCharIndex(const savaFont* fontPtr, uint32_t code_point) const {
     if (!fontPtr) return 0xFFFF;
 
+    // --- Шрифт с таблицей диапазонов Unicode ---
+    if (fontPtr->ranges) {
+        uint16_t index = find_range_index(fontPtr->ranges, fontPtr->range_count, code_point);
+        if (index == 0xFFFF && code_point >= 0x80) { // нет глифа - как и раньше, рисуем '?'
+            index = find_range_index(fontPtr->ranges, fontPtr->range_count, '?');
+        }
+        return index;
+    }
+
+    uint16_t char_code = unicode_to_cp1251(code_point);
+
     // --- Тип 0: Numbers (Цифры и спецсимволы) ---
     if (fontPtr->font_index == 0) {
         if (char_code >= '0' && char_code <= '9') return char_code - '0' + 1; // '0' -> 1
@@ -1282,24 +3493,899 @@ uint16_t SavaOLED_ESP32::_getCharIndex(const savaFont* fontPtr, uint16_t char_co
 
 
 
+uint32_t SavaOLED_ESP32::_measureRun(const char* text, uint16_t length, const savaFont* fontPtr, uint8_t spacing, uint8_t scale) const {
+    if (!text || !fontPtr) return 0;
+    scale = fit_scale(fontPtr, scale, LINE_BUFFER_PAGES * 8);
+    uint32_t pen = 0;
+    uint16_t i = 0;
+    while (i < length) {
+        uint16_t index = _getCharIndex(fontPtr, utf8_next(text, length, i));
+        if (index == 0xFFFF) continue;
+        pen += glyph_width(&fontPtr->data[fontPtr->offsets[index]]) * scale + spacing;
+    }
+    return pen;
+}
+
+void SavaOLED_ESP32::_drawChartColumn(const ChartWidget &chart, int16_t col, float prev, float value) {
+    if (std::isnan(value)) return;
+    int16_t row = chart_row(chart, value);
+    switch (chart.style) {
+        case CHART_BAR:
+            vLine(col, row, chart.y + chart.h - row, REPLACE);
+            break;
+        case CHART_DOT:
+            dot(col, row, REPLACE);
+            break;
+        default: {
+            // Линия: вертикальный отрезок от уровня предыдущего отсчёта до текущего
+            int16_t from = std::isnan(prev) ? row : chart_row(chart, prev);
+            int16_t top = (from < row) ? from : row;
+            int16_t bottom = (from > row) ? from : row;
+            vLine(col, top, bottom - top + 1, REPLACE);
+            break;
+        }
+    }
+}
+
+void SavaOLED_ESP32::_drawNumberCell(const NumberWidget &widget, uint8_t cell, uint8_t offset) {
+    const savaFont* fontPtr = widget.fontPtr;
+    uint8_t pages_per_char = (fontPtr->height + 7) / 8;
+    uint8_t height = (fontPtr->height < 32) ? fontPtr->height : 32;
+    uint32_t height_mask = (height < 32) ? ((1UL << height) - 1) : 0xFFFFFFFFUL;
+
+    // Колонки символов (до 32 строк) - те же, что рисует drawPrint; читаются по одной вместе с колонками ячейки
+    const uint8_t* char_from = nullptr;
+    const uint8_t* char_to = nullptr;
+    if (offset < height) {
+        uint16_t index = _getCharIndex(fontPtr, widget.from[cell]);
+        if (index != 0xFFFF) char_from = &fontPtr->data[fontPtr->offsets[index]];
+    }
+    if (offset > 0) {
+        uint16_t index = _getCharIndex(fontPtr, widget.to[cell]);
+        if (index != 0xFFFF) char_to = &fontPtr->data[fontPtr->offsets[index]];
+    }
+    GlyphColumnReader glyph_from(char_from, pages_per_char);
+    GlyphColumnReader glyph_to(char_to, pages_per_char);
+
+    // Сдвиг колонки на страницы экрана: 64-битное окно с началом на странице y_page
+    const uint8_t pages = _height / 8;
+    int16_t y_page = widget.y >> 3; // с округлением вниз и для y < 0
+    uint8_t y_offset = widget.y & 7;
+    uint64_t cover = (uint64_t)height_mask << y_offset;
+    int16_t cell_x = widget.x + cell * (widget.cellWidth + widget.spacing);
+
+    for (uint8_t col = 0; col < widget.cellWidth; col++) {
+        // Колонки читаются и для невидимых экранных колонок: поток сжатого символа идёт только вперёд
+        uint32_t column_from = glyph_from.next();
+        uint32_t column_to = glyph_to.next();
+        int16_t screen_x = cell_x + col;
+        if (screen_x < 0 || screen_x >= _width) continue;
+        uint32_t column = (column_from & height_mask) >> offset;
+        if (offset > 0) column |= ((column_to & height_mask) << (height - offset)) & height_mask;
+        uint64_t data = (uint64_t)column << y_offset;
+        for (uint8_t p = 0; p < 5; p++) {
+            int16_t page = y_page + p;
+            uint8_t mask = (uint8_t)(cover >> (p * 8));
+            if (mask == 0 || page < _bufferPage0 || page >= _bufferPage0 + _bufferPages || page >= pages) continue;
+            uint8_t &dest = _pageRow(page)[screen_x];
+            dest = (dest & ~mask) | ((uint8_t)(data >> (p * 8)) & mask);
+        }
+    }
+}
+
+const uint8_t* SavaOLED_ESP32::_cachedShiftedGlyph(const savaFont* fontPtr, uint16_t index, const uint8_t* char_ptr, uint8_t pages_per_char, uint8_t shift) {
+    if (!_glyphSlots) return nullptr;
+    uint8_t width = glyph_width(char_ptr);
+    uint16_t need = width * (pages_per_char + 1);
+    if (need == 0 || need > _glyphPoolSize) return nullptr;
+
+    // Прямое отображение: (шрифт, символ, сдвиг) -> один слот
+    uint32_t key = (uint32_t)(uintptr_t)fontPtr ^ ((uint32_t)index << 3) ^ shift;
+    GlyphCacheEntry &entry = _glyphSlots[((key * 2654435761UL) >> 16) % GLYPH_CACHE_SLOTS];
+    if (entry.fontPtr == fontPtr && entry.index == index && entry.shift == shift) {
+        _glyphCacheHits++;
+        return _glyphPool.get() + entry.offset;
+    }
+    _glyphCacheMisses++;
+
+    // Пул заполнен (в том числе колонками вытесненных из слотов символов): начинаем заново
+    if (_glyphPoolUsed + need > _glyphPoolSize) {
+        for (uint8_t i = 0; i < GLYPH_CACHE_SLOTS; i++) _glyphSlots[i].fontPtr = nullptr;
+        _glyphPoolUsed = 0;
+    }
+
+    // Колонки символа в порядке хранения шрифта: [страница 0] [страница 1] ... + пустая строка снизу
+    uint8_t* dest = _glyphPool.get() + _glyphPoolUsed;
+    if (*char_ptr & FONT_RLE_FLAG) {
+        RleStream stream(char_ptr + 1);
+        for (uint16_t k = 0; k < width * pages_per_char; k++) dest[k] = stream.next();
+    } else {
+        memcpy(dest, char_ptr + 1, width * pages_per_char);
+    }
+    memset(dest + width * pages_per_char, 0, width);
+    shift_columns(dest, width, 0, width, pages_per_char, shift);
+
+    entry.fontPtr = fontPtr;
+    entry.index = index;
+    entry.offset = _glyphPoolUsed;
+    entry.shift = shift;
+    entry.width = width;
+    _glyphPoolUsed += need;
+    return dest;
+}
+
+void SavaOLED_ESP32::_getVertMetrics(const savaFont* fontPtr, uint16_t index, uint8_t &skip_top, uint8_t &real_height) {
+    uint8_t font_h_pixels = fontPtr->height;
+
+    // --- Быстрый путь: метрики сгенерированы вместе со шрифтом ---
+    if (fontPtr->vmetrics) {
+        skip_top = fontPtr->vmetrics[index * 2];
+        real_height = fontPtr->vmetrics[index * 2 + 1];
+        return;
+    }
+
+    // --- Запасной путь: собираем OR всех колонок в одну маску по вертикали ---
+    uint32_t cols[128];
+    uint8_t raw_width = glyph_columns(&fontPtr->data[fontPtr->offsets[index]], (font_h_pixels + 7) / 8, cols);
+
+    uint32_t rows_mask = 0;
+    for (uint8_t col = 0; col < raw_width; col++) rows_mask |= cols[col];
+    if (font_h_pixels < 32) rows_mask &= (1UL << font_h_pixels) - 1;
+
+    if (rows_mask == 0) {
+        // Пробел: фиксированная высота промежутка
+        skip_top = font_h_pixels;
+        real_height = (font_h_pixels > 4) ? (font_h_pixels / 3) : 4;
+        return;
+    }
+    skip_top = __builtin_ctz(rows_mask);
+    real_height = (31 - __builtin_clz(rows_mask)) - skip_top + 1;
+}
+
+uint32_t SavaOLED_ESP32::_vertTextSignature() const {
+    // FNV-1a по тексту, шрифтам сегментов и интервалу — дешевле одного рендера ленты
+    uint32_t hash = 2166136261UL;
+    auto mix = [&hash](uint32_t v) { hash = (hash ^ v) * 16777619UL; };
+    mix(_charSpacing);
+    for (uint8_t s = 0; s < _segmentCount; ++s) {
+        mix((uint32_t)(uintptr_t)_segments[s].fontPtr);
+        const char* text = _segments[s].text;
+        if (!text) continue;
+        for (uint16_t i = 0; i < _segments[s].length; i++) mix((uint8_t)text[i]);
+        mix(0xFF); // граница сегмента
+    }
+    return hash;
+}
+
+void SavaOLED_ESP32::_renderVertTape() {
+    _vertBufferHeight = 0;
+    _vertBufferWidth = 0;
+
+    // --- Проход 1: измерение ленты (ширина = самый широкий символ, высота = сумма высот) ---
+    uint16_t total_pixel_height = 0;
+    uint8_t tape_width = 0;
+    for (uint8_t s = 0; s < _segmentCount; ++s) {
+        const auto& segment = _segments[s];
+        if (!segment.fontPtr || !segment.text) continue;
+        const savaFont* fontPtr = segment.fontPtr;
+        uint16_t i = 0;
+        while (i < segment.length) {
+            uint32_t char_code = utf8_next(segment.text, segment.length, i);
+            uint16_t index = _getCharIndex(fontPtr, char_code);
+            if (index == 0xFFFF) continue;
+
+            uint8_t raw_width = glyph_width(&fontPtr->data[fontPtr->offsets[index]]);
+            uint8_t skip_top, real_height;
+            _getVertMetrics(fontPtr, index, skip_top, real_height);
+            if (raw_width > tape_width) tape_width = raw_width;
+            total_pixel_height += real_height + _charSpacing;
+        }
+    }
+    if (tape_width == 0 || total_pixel_height == 0) return;
+    total_pixel_height -= _charSpacing; // убираем последний интервал
+
+    // Лента хранится по колонкам: _vertBuffer[col * _vertTapePages + page]
+    uint16_t max_pages = VERT_BUF_SIZE / tape_width;
+    if ((uint32_t)total_pixel_height > (uint32_t)max_pages * 8) {
+        OLED_WARN("Vertical tape overflow! Height: %u, Max: %u", total_pixel_height, max_pages * 8);
+        total_pixel_height = max_pages * 8;
+    }
+    _vertTapePages = (total_pixel_height + 7) / 8;
+    if (!_vertBuffer) _vertBuffer = std::make_unique<uint8_t[]>(VERT_BUF_SIZE);
+    memset(_vertBuffer.get(), 0, tape_width * _vertTapePages);
+
+    // --- Проход 2: укладка символов в ленту (каждый своим шрифтом сегмента) ---
+    uint16_t y = 0;
+    for (uint8_t s = 0; s < _segmentCount; ++s) {
+        const auto& segment = _segments[s];
+        if (!segment.fontPtr || !segment.text) continue;
+        const savaFont* fontPtr = segment.fontPtr;
+        uint8_t pages_per_char = (fontPtr->height + 7) / 8;
+        uint16_t i = 0;
+        while (i < segment.length && y < total_pixel_height) {
+            uint32_t char_code = utf8_next(segment.text, segment.length, i);
+            uint16_t index = _getCharIndex(fontPtr, char_code);
+            if (index == 0xFFFF) continue;
+
+            uint32_t cols[128];
+            uint8_t raw_width = glyph_columns(&fontPtr->data[fontPtr->offsets[index]], pages_per_char, cols);
+            uint8_t skip_top, real_height;
+            _getVertMetrics(fontPtr, index, skip_top, real_height);
+
+            uint16_t base_page = y / 8;
+            uint8_t y_bit_shift = y % 8;
+            for (uint8_t col = 0; col < raw_width; col++) {
+                // Данные символа (до 4 страниц)
+                uint32_t col_data = cols[col];
+                col_data = (skip_top < 32) ? (col_data >> skip_top) : 0;
+                if (real_height < 32) {
+                    col_data &= (1UL << real_height) - 1;
+                }
+                uint64_t render_data = (uint64_t)col_data << y_bit_shift;
+
+                uint8_t* tape_col = &_vertBuffer.get()[col * _vertTapePages];
+                for (uint16_t page = base_page; render_data && page < _vertTapePages; page++) {
+                    tape_col[page] |= (uint8_t)(render_data & 0xFF);
+                    render_data >>= 8;
+                }
+            }
+            y += real_height + _charSpacing;
+        }
+    }
+
+    _vertBufferWidth = tape_width;
+    _vertBufferHeight = total_pixel_height;
+}
+
+void SavaOLED_ESP32::_fetchVertTape(uint8_t col, int32_t src_y, uint8_t &data, uint8_t &mask) const {
+    data = 0;
+    mask = 0;
+    if (src_y >= (int32_t)_vertBufferHeight || src_y + 8 <= 0) return;
+
+    // Два соседних байта колонки ленты -> 8 бит, начиная с бита src_y
+    int32_t byte_idx = (src_y >= 0) ? (src_y / 8) : -1;
+    uint8_t bit_shift = src_y - byte_idx * 8;
+    const uint8_t* tape_col = &_vertBuffer.get()[col * _vertTapePages];
+    uint16_t word = 0;
+    if (byte_idx >= 0) word = tape_col[byte_idx];
+    if (byte_idx + 1 < (int32_t)_vertTapePages) word |= (uint16_t)tape_col[byte_idx + 1] << 8;
+    data = (uint8_t)(word >> bit_shift);
+
+    // Маска: только биты внутри [0, _vertBufferHeight)
+    int32_t lo = (src_y < 0) ? -src_y : 0;
+    int32_t hi = (int32_t)_vertBufferHeight - src_y;
+    if (hi > 8) hi = 8;
+    mask = (uint8_t)(((1U << hi) - 1) & ~((1U << lo) - 1));
+}
+
+void SavaOLED_ESP32::_layoutTextBox(const char* text, uint16_t length) {
+    _boxLineCount = 0;
+    const savaFont* fontPtr = _currentFont;
+    uint8_t scale = fit_scale(fontPtr, _textScale, LINE_BUFFER_PAGES * 8); // как в drawPrint()
+
+    uint16_t line_start = 0;     // начало текущей строки
+    int32_t pen = 0;             // ширина строки с интервалом после последнего символа
+    int32_t space_pos = -1;      // последний пробел в строке (кандидат на перенос по словам)
+    bool skip_spaces = false;    // после автоматического переноса пробелы в начале строки пропускаются
+
+    auto emit = [this](uint16_t start, uint16_t end) -> bool {
+        if (_boxLineCount >= MAX_BOX_LINES) {
+            OLED_WARN("textBox: more than %d lines, rest is dropped", MAX_BOX_LINES);
+            return false;
+        }
+        _boxLines[_boxLineCount].start = start;
+        _boxLines[_boxLineCount].length = end - start;
+        _boxLineCount++;
+        return true;
+    };
+
+    uint16_t i = 0;
+    while (i < length) {
+        uint16_t char_start = i;
+        if (skip_spaces) {
+            if (text[i] == ' ') { i++; line_start = i; continue; }
+            skip_spaces = false;
+        }
+        if (text[i] == '\n') {
+            if (!emit(line_start, i)) return;
+            i++;
+            line_start = i;
+            pen = 0;
+            space_pos = -1;
+            continue;
+        }
+
+        uint32_t code_point = utf8_next(text, length, i);
+        uint16_t index = _getCharIndex(fontPtr, code_point);
+        if (index == 0xFFFF) continue; // символа нет в шрифте - drawPrint() его тоже пропустит
+        uint16_t advance = glyph_width(&fontPtr->data[fontPtr->offsets[index]]) * scale;
+
+        if (pen + advance > _boxW && char_start > line_start) {
+            if (_boxWordWrap && space_pos > line_start) {
+                // Перенос по словам: строка заканчивается перед пробелом, слово уходит на следующую
+                if (!emit(line_start, space_pos)) return;
+                i = space_pos + 1;
+            } else {
+                // Перенос по символам: текущий символ начинает следующую строку
+                if (!emit(line_start, char_start)) return;
+                i = char_start;
+            }
+            line_start = i;
+            pen = 0;
+            space_pos = -1;
+            skip_spaces = true;
+            continue;
+        }
+        if (code_point == ' ') space_pos = char_start;
+        pen += advance + _charSpacing;
+    }
+    if (line_start < length) emit(line_start, length);
+}
+
+void SavaOLED_ESP32::_listReplay(const int16_t (*dirty)[4], uint8_t dirty_count) {
+    // Текстовые команды подменяют курсор и фрагменты строки - настройки пользователя восстанавливаются после
+    int16_t user_x = _cursorX, user_y = _cursorY, user_x2 = _cursorX2;
+    uint8_t user_align = _cursorAlign;
+    uint8_t user_spacing = _charSpacing;
+    bool user_scroll = _scrollEnabled;
+    _listRedrawn = 0;
+
+    if (_stripPages) {
+        _streamStrips(dirty, dirty_count);
+    } else {
+        // Область очищается, в ней рисуются все касающиеся её команды в порядке записи
+        _listRedrawn = _rasterFrame(_listPrev.get(), _listPrevCount, _listSegments.get(), dirty, dirty_count, true);
+    }
+
+    _resetClip();
+    _charSpacing = user_spacing;
+    _scrollEnabled = user_scroll;
+    cursor(user_x, user_y, user_align, user_x2);
+}
+
+void SavaOLED_ESP32::_listDrawClipped() {
+    for (uint8_t i = 0; i < _listPrevCount; i++) {
+        const DisplayListItem &item = _listPrev[i];
+        if (item.x0 >= _clipX1 || item.x1 <= _clipX0 || item.y0 >= _clipY1 || item.y1 <= _clipY0) continue;
+        _listDraw(item, _listSegments.get());
+        _listRedrawn++;
+    }
+}
+
+void SavaOLED_ESP32::_streamStrips(const int16_t (*dirty)[4], uint8_t dirty_count) {
+    const uint8_t canvas_pages = _height / 8;
+    for (uint8_t page = 0; page < canvas_pages; page += _stripPages) {
+        uint8_t strip_pages = (canvas_pages - page < _stripPages) ? (canvas_pages - page) : _stripPages;
+        int16_t strip_y0 = page * 8;
+        int16_t strip_y1 = (page + strip_pages) * 8;
+
+        // Колонки полосы, задетые изменениями. Прежнего содержимого полосы нет - строки собираются целиком
+        int16_t x0 = _width, x1 = 0;
+        for (uint8_t r = 0; r < dirty_count; r++) {
+            if (dirty[r][1] >= strip_y1 || dirty[r][3] <= strip_y0) continue;
+            if (dirty[r][0] < x0) x0 = dirty[r][0];
+            if (dirty[r][2] > x1) x1 = dirty[r][2];
+        }
+        if (x0 >= x1) continue;
+
+        _bufferPage0 = page;
+        _clipX0 = x0;
+        _clipY0 = strip_y0;
+        _clipX1 = x1;
+        _clipY1 = strip_y1;
+        _clearClip();
+        _listDrawClipped();
+        _sendStrip(page, strip_pages, x0, x1);
+    }
+    _bufferPage0 = 0;
+}
+
+void SavaOLED_ESP32::_sendStrip(uint8_t page, uint8_t pages, int16_t x0, int16_t x1) {
+    if (!_initialized || !_dev_handle) return;
+    const uint8_t window_cmds[] = {
+        OLED_COLUMN_ADDR, (uint8_t)x0, (uint8_t)(x1 - 1),
+        OLED_PAGE_ADDR, page, (uint8_t)(page + pages - 1)
+    };
+    _sendCommands(window_cmds, sizeof(window_cmds));
+    uint16_t count = x1 - x0;
+    for (uint8_t p = 0; p < pages; p++) {
+        _tx_buffer[0] = 0x40; // Управляющий байт для данных
+        memcpy(&_tx_buffer[1], _buffer.get() + (page - _bufferPage0 + p) * _width + x0, count);
+        esp_err_t ret = i2c_master_transmit(_dev_handle, _tx_buffer.get(), count + 1, 500);
+        if (ret != ESP_OK) {
+            OLED_ERROR("Strip page %u transmit failed: %s (0x%X)", (unsigned)(page + p), esp_err_to_name(ret), ret);
+        }
+    }
+}
+
+void SavaOLED_ESP32::_fillClip(uint8_t pattern) {
+    int16_t full_y1 = (_bufferPage0 + _bufferPages) * 8;
+    if (full_y1 > _height) full_y1 = _height;
+    if (_clipX0 <= 0 && _clipX1 >= _width && _clipY0 <= _bufferPage0 * 8 && _clipY1 >= full_y1) {
+        // Используем memset для быстрой заливки всего массива одним байтом (экран или холст canvasBegin)
+        memset(_target, pattern, _bufferPages * _width);
+        return;
+    }
+    // Часть окна (layerBegin со строками): крайние страницы - по маске строк
+    for (int16_t page = _clipY0 >> 3; page * 8 < _clipY1; page++) {
+        uint8_t mask = page_rows_mask(page, _clipY0, _clipY1);
+        uint8_t* row = _pageRow(page);
+        for (int16_t x = _clipX0; x < _clipX1; x++) row[x] = (row[x] & ~mask) | (pattern & mask);
+    }
+}
+
+void SavaOLED_ESP32::_fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t mode) {
+    int32_t x_start = (x > _clipX0) ? x : _clipX0;
+    int32_t x_end = ((int32_t)x + w < _clipX1) ? (int32_t)x + w : _clipX1;
+    int32_t y_start = (y > _clipY0) ? y : _clipY0;
+    int32_t y_end = ((int32_t)y + h < _clipY1) ? (int32_t)y + h : _clipY1;
+    if (x_start >= x_end || y_start >= y_end) return;
+    const uint16_t count = x_end - x_start;
+    for (int32_t page = y_start >> 3; page <= (y_end - 1) >> 3; page++) {
+        uint8_t mask = page_rows_mask(page, y_start, y_end);
+        uint8_t* row = _pageRow(page) + x_start;
+        switch (mode) {
+            case ERASE_BORDER:
+            case ADD_UP:
+            case REPLACE:
+                if (mask == 0xFF) memset(row, 0xFF, count);
+                else for (uint16_t i = 0; i < count; i++) row[i] |= mask;
+                break;
+            case INV_AUTO: for (uint16_t i = 0; i < count; i++) row[i] ^= mask; break;
+            case ERASE:
+                if (mask == 0xFF) memset(row, 0x00, count);
+                else for (uint16_t i = 0; i < count; i++) row[i] &= ~mask;
+                break;
+        }
+    }
+}
+
+void SavaOLED_ESP32::_markLayerRows(int16_t y0, int16_t y1) {
+    for (int16_t page = y0 >> 3; page * 8 < y1 && page < 32; page++) _layerDirty |= 1UL << page;
+}
+
+void SavaOLED_ESP32::_composeLayers() {
+    uint32_t dirty = _layerDirty;
+    _layerDirty = 0;
+    _composedPages = 0;
+    if (!dirty) return;
+
+    LayerOp ops[SAVA_MAX_LAYERS];
+    uint8_t count_ops = 0;
+    for (uint8_t l = 0; l < _layerCount; l++) {
+        const SavaLayer &layer = _layers[l];
+        if (!layer.visible) continue;
+        LayerOp &op = ops[count_ops++];
+        op.src = layer.canvas.buffer.get();
+        op.keep = (layer.mode == REPLACE) ? 0 : 0xFFFFFFFFUL;
+        op.hole = (layer.mode == ADD_UP || layer.mode == ERASE) ? 0xFFFFFFFFUL : 0;
+        op.ink = (layer.mode == ERASE) ? 0 : 0xFFFFFFFFUL;
+    }
+    // Подряд идущие изменённые страницы собираются одним проходом
+    uint8_t* out = _buffer.get();
+    uint8_t pages = _bufferPages;
+    for (uint8_t p = 0; p < pages;) {
+        if (!(dirty & (1UL << p))) { p++; continue; }
+        uint8_t q = p;
+        while (q < pages && (dirty & (1UL << q))) q++;
+        compose_span(out, ops, count_ops, p * _width, (q - p) * _width);
+        _composedPages += q - p;
+        p = q;
+    }
+}
+
+void SavaOLED_ESP32::_resetClip() {
+    _clipX0 = 0;
+    _clipX1 = _width;
+    _clipY0 = _bufferPage0 * 8;
+    _clipY1 = (_bufferPage0 + _bufferPages) * 8;
+    if (_clipY1 > _height) _clipY1 = _height;
+}
+
+DisplayListItem* SavaOLED_ESP32::_listAdd(uint8_t type, uint8_t mode, int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    if (_listCount >= _listCapacity) {
+        OLED_WARN("display list is full (%u items), command dropped", _listCapacity);
+        _listOverflow = true;
+        return nullptr;
+    }
+    DisplayListItem* item = &_listItems[_listCount++];
+    memset(item, 0, sizeof(DisplayListItem));
+    item->type = type;
+    item->mode = mode;
+    item->x0 = x0;
+    item->y0 = y0;
+    item->x1 = x1;
+    item->y1 = y1;
+    return item;
+}
+
+void SavaOLED_ESP32::_listAddText() {
+    // Габариты строки - как в drawPrint: область от _cursorX шириной region_width, высота - целые страницы строки
+    uint8_t max_line_pages = 1;
+    uint16_t text_bytes = 0;
+    for (uint8_t s = 0; s < _segmentCount; ++s) {
+        const auto& segment = _segments[s];
+        text_bytes += segment.length;
+        if (!segment.fontPtr) continue;
+        uint8_t pages_per_char = (segment.fontPtr->height * segment.scale + 7) / 8;
+        if (pages_per_char > LINE_BUFFER_PAGES) pages_per_char = LINE_BUFFER_PAGES;
+        if (pages_per_char > max_line_pages) max_line_pages = pages_per_char;
+    }
+    if (_listSegmentCount + _segmentCount > _listCapacity || _listTextUsed + text_bytes > _listTextSize) {
+        OLED_WARN("display list: no room for text (%u bytes), line dropped", text_bytes);
+        _listOverflow = true;
+        return;
+    }
+    int16_t region_width = (_cursorX2 > 0) ? _cursorX2 : (_width - _cursorX);
+    DisplayListItem* item = _listAdd(DL_TEXT, _drawMode, _cursorX, _cursorY, _cursorX + region_width, _cursorY + max_line_pages * 8);
+    if (!item) return;
+    item->flags = _cursorAlign | ((_scrollEnabled && _cursorAlign == StrScroll) ? 0x80 : 0);
+    item->p[0] = _cursorX;
+    item->p[1] = _cursorY;
+    item->p[2] = _cursorX2;
+    item->p[3] = _charSpacing;
+    item->p[4] = _scrollEnabled;
+    item->first = _listSegmentCount;
+    item->count = _segmentCount;
+    for (uint8_t s = 0; s < _segmentCount; ++s) {
+        TextSegment &copy = _listSegments[_listSegmentCount++];
+        copy = _segments[s];
+        if (copy.text && copy.length) memcpy(&_listText[_listTextUsed], copy.text, copy.length);
+        copy.text = &_listText[_listTextUsed];
+        _listTextUsed += copy.length;
+    }
+}
+
+uint32_t SavaOLED_ESP32::_listSignature(const DisplayListItem &item) const {
+    uint32_t hash = 2166136261UL;
+    auto mix = [&hash](uint32_t v) { hash = (hash ^ v) * 16777619UL; };
+    mix(item.type);
+    mix(item.mode);
+    mix(item.flags);
+    for (uint8_t i = 0; i < 6; i++) mix((uint16_t)item.p[i]);
+    mix((uint32_t)(uintptr_t)item.data);
+    if (item.type == DL_BITMAP && item.data && item.p[2] > 0 && item.p[3] > 0) {
+        // Картинка в RAM может меняться по тому же адресу - сравнивается содержимое
+        uint32_t bytes = (uint32_t)item.p[2] * ((item.p[3] + 7) / 8);
+        for (uint32_t i = 0; i < bytes; i++) mix(item.data[i]);
+    }
+    if (item.type == DL_CANVAS) {
+        // Холст перерисовывается на месте - сравнивается содержимое
+        const SavaCanvas* canvas = (const SavaCanvas*)item.data;
+        uint32_t bytes = (uint32_t)canvas->width * (canvas->height / 8);
+        for (uint32_t i = 0; i < bytes; i++) mix(canvas->buffer[i]);
+    }
+    if (item.type == DL_TEXT) {
+        for (uint8_t s = 0; s < item.count; s++) {
+            const TextSegment &segment = _listSegments[item.first + s];
+            mix((uint32_t)(uintptr_t)segment.fontPtr);
+            mix(segment.scale);
+            mix(segment.drawMode);
+            mix(segment.length);
+            for (uint16_t i = 0; i < segment.length; i++) mix((uint8_t)segment.text[i]);
+        }
+    }
+    return hash;
+}
+
+void SavaOLED_ESP32::_listDraw(const DisplayListItem &item, const TextSegment* segments) {
+    const int16_t* p = item.p;
+    switch (item.type) {
+        case DL_DOT:        dot(p[0], p[1], item.mode); break;
+        case DL_LINE:       line(p[0], p[1], p[2], p[3], item.mode); break;
+        case DL_RECT:       rect(p[0], p[1], p[2], p[3], item.mode, item.flags); break;
+        case DL_RECT_R:     rectR(p[0], p[1], p[2], p[3], p[4], item.mode, item.flags); break;
+        case DL_CIRCLE:     circle(p[0], p[1], p[2], item.mode, item.flags); break;
+        case DL_BEZIER:     bezier(p[0], p[1], p[2], p[3], p[4], p[5], item.mode); break;
+        case DL_BITMAP:     drawBitmap(p[0], p[1], item.data, p[2], p[3], item.mode); break;
+        case DL_BITMAP_RLE: drawBitmapRLE(p[0], p[1], item.data, p[2], p[3], item.mode); break;
+        case DL_CANVAS:     drawCanvas(*(const SavaCanvas*)item.data, p[0], p[1], item.mode); break;
+        case DL_TEXT:
+            // Строка восстанавливается из копии и рисуется заново (с учётом окна отсечения)
+            _cursorX = p[0];
+            _cursorY = p[1];
+            _cursorX2 = p[2];
+            _cursorAlign = item.flags & 0x03;
+            _charSpacing = p[3];
+            _scrollEnabled = p[4];
+            memcpy(_segments, &segments[item.first], item.count * sizeof(TextSegment));
+            _segmentCount = item.count;
+            _lineChanged = true;
+            drawPrint();
+            break;
+    }
+}
+
+void SavaOLED_ESP32::_renderTaskEntry(void* arg) {
+    static_cast<SavaOLED_ESP32*>(arg)->_renderLoop();
+}
+
+void SavaOLED_ESP32::_renderLoop() {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        // Под мьютексом только рисование очереди и копия кадра; передача идёт, пока задачи пишут следующие порции
+        xSemaphoreTake(_renderMutex, portMAX_DELAY);
+        bool ready = _listCount > 0;
+        if (ready) _renderDrain();
+        if (_drainCommands()) ready = true;
+        if (ready) {
+            memcpy(&_tx_buffer[1], _panelFrame(), _bufferSize);
+            _renderFrames++; // счётчики меняются под мьютексом - их можно читать внутри порции
+        }
+        bool stop = _renderStop;
+        xSemaphoreGive(_renderMutex);
+        if (ready && _initialized) _sendSnapshot();
+        if (stop) break;
+    }
+    xSemaphoreGive(_renderDone);
+    vTaskDelete(NULL);
+}
+
+void SavaOLED_ESP32::_renderDrain() {
+    // Команды рисуются сразу, в порядке записи; настройки текста пользователя восстанавливаются после
+    int16_t user_x = _cursorX, user_y = _cursorY, user_x2 = _cursorX2;
+    uint8_t user_align = _cursorAlign;
+    uint8_t user_spacing = _charSpacing;
+    bool user_scroll = _scrollEnabled;
+
+    const int16_t full[1][4] = { { 0, 0, _width, _height } };
+    _rasterFrame(_listItems.get(), _listCount, _listSegments.get(), full, 1, false);
+    _resetClip();
+    _listCount = 0;
+    _listSegmentCount = 0;
+    _listTextUsed = 0;
+
+    _charSpacing = user_spacing;
+    _scrollEnabled = user_scroll;
+    cursor(user_x, user_y, user_align, user_x2);
+}
+
+bool SavaOLED_ESP32::_drainCommands() {
+    if (!_queueSlots) return false;
+    // Готовые команды [tail, end): до первого слота, который ещё заполняется или пуст
+    uint32_t tail = _queueTail.load(std::memory_order_relaxed);
+    uint32_t end = tail;
+    while (end - tail <= _queueMask && _queueSlots[end & _queueMask].seq.load(std::memory_order_acquire) == end + 1) end++;
+    if (end == tail) return false;
+    if (end - tail > _queuePeak) _queuePeak = end - tail;
+
+    // Текстовые команды подменяют шрифт, курсор и режим - настройки пользователя восстанавливаются после
+    int16_t user_x = _cursorX, user_y = _cursorY, user_x2 = _cursorX2;
+    uint8_t user_align = _cursorAlign;
+    const savaFont* user_font = _currentFont;
+    uint8_t user_mode = _drawMode;
+    uint8_t user_scale = _textScale;
+    bool user_scroll = _scrollEnabled;
+    _textScale = 1;
+    _scrollEnabled = false;
+
+    for (uint32_t i = tail; i != end; i++) {
+        CommandSlot &slot = _queueSlots[i & _queueMask];
+        if (slot.cmd.type == CMD_WIDGET) {
+            // Отметка снимается до чтения: запись, закончившаяся позже, поставит новую отметку в кольцо.
+            // Поэтому ячейку, которую сейчас пишут, можно пропустить без ожидания - её нарисует следующий проход
+            CommandBox &box = _queueBoxes[slot.cmd.widget - 1];
+            box.pending.store(false, std::memory_order_seq_cst);
+            uint32_t seq = box.seq.load(std::memory_order_seq_cst);
+            uint32_t words[CommandBox::WORDS];
+            for (uint8_t w = 0; w < CommandBox::WORDS; w++) words[w] = box.words[w].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (!(seq & 1) && box.seq.load(std::memory_order_relaxed) == seq) {
+                SavaCommand cmd;
+                memcpy(&cmd, words, sizeof(SavaCommand));
+                _drawCommand(cmd);
+            }
+        } else {
+            _drawCommand(slot.cmd);
+        }
+        slot.seq.store(i + _queueMask + 1, std::memory_order_release); // слот свободен для следующего круга
+    }
+    _queueTail.store(end, std::memory_order_relaxed);
+
+    _currentFont = user_font;
+    _drawMode = user_mode;
+    _textScale = user_scale;
+    _scrollEnabled = user_scroll;
+    cursor(user_x, user_y, user_align, user_x2);
+    return true;
+}
+
+void SavaOLED_ESP32::_drawCommand(const SavaCommand &cmd) {
+    switch (cmd.type) {
+        case CMD_DOT:        dot(cmd.x, cmd.y, cmd.mode); break;
+        case CMD_LINE:       line(cmd.x, cmd.y, cmd.w, cmd.h, cmd.mode); break;
+        case CMD_RECT:       rect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.mode, cmd.flags & 1); break;
+        case CMD_CIRCLE:     circle(cmd.x, cmd.y, cmd.w, cmd.mode, cmd.flags & 1); break;
+        case CMD_BITMAP:     drawBitmap(cmd.x, cmd.y, (const uint8_t*)cmd.ref, cmd.w, cmd.h, cmd.mode); break;
+        case CMD_BITMAP_RLE: drawBitmapRLE(cmd.x, cmd.y, (const uint8_t*)cmd.ref, cmd.w, cmd.h, cmd.mode); break;
+        case CMD_TEXT:
+        case CMD_NUMBER:
+            if (cmd.w > 0 && cmd.h > 0) rect(cmd.x, cmd.y, cmd.w, cmd.h, ERASE, FILL);
+            if (!cmd.ref) break;
+            _currentFont = (const savaFont*)cmd.ref;
+            _drawMode = cmd.mode;
+            cursor(cmd.x, cmd.y, cmd.flags & 0x03, (cmd.w > 0) ? cmd.w : -1); // drawPrint: x2 - ширина области
+            if (cmd.type == CMD_TEXT) {
+                printRef(cmd.text, strnlen(cmd.text, SAVA_CMD_TEXT)); // слот не меняется до конца drawPrint
+            } else {
+                print(cmd.value, cmd.flags >> 4);
+            }
+            drawPrint();
+            break;
+    }
+}
+
+void SavaOLED_ESP32::_wakeRender() {
+    if (xPortInIsrContext()) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(_renderTaskHandle, &woken);
+        if (woken) portYIELD_FROM_ISR();
+    } else {
+        xTaskNotifyGive(_renderTaskHandle);
+    }
+}
+
+void SavaOLED_ESP32::_sendSnapshot() {
+    const uint8_t display_cmds[] = {
+        OLED_COLUMN_ADDR, 0, (uint8_t)(_panelWidth - 1),
+        OLED_PAGE_ADDR, 0, (uint8_t)((_panelHeight / 8) - 1)
+    };
+    _sendCommands(display_cmds, sizeof(display_cmds));
+    if (!_dev_handle) return;
+    if (_Buffer) {
+        _tx_buffer[0] = 0x40; // Управляющий байт для данных
+        esp_err_t ret = i2c_master_transmit(_dev_handle, _tx_buffer.get(), _bufferSize + 1, 1000);
+        if (ret != ESP_OK) {
+            OLED_ERROR("Full buffer transmit failed: %s (0x%X)", esp_err_to_name(ret), ret);
+        }
+        return;
+    }
+    // По страницам без второй копии: управляющий байт на время передачи занимает последний байт предыдущей страницы
+    const uint8_t pages = _panelHeight / 8;
+    for (uint8_t p = 0; p < pages; ++p) {
+        uint8_t* chunk = &_tx_buffer[p * _panelWidth];
+        uint8_t saved = chunk[0];
+        chunk[0] = 0x40;
+        esp_err_t ret = i2c_master_transmit(_dev_handle, chunk, _panelWidth + 1, 500);
+        chunk[0] = saved;
+        if (ret != ESP_OK) {
+            OLED_ERROR("Page %u transmit failed: %s (0x%X)", (unsigned)p, esp_err_to_name(ret), ret);
+        }
+    }
+}
+
+uint8_t SavaOLED_ESP32::_rasterRegions(const DisplayListItem* items, uint8_t count, const TextSegment* segments,
+                                       const int16_t (*regions)[4], uint8_t region_count, bool clear, int16_t y0, int16_t y1) {
+    uint8_t drawn = 0;
+    for (uint8_t r = 0; r < region_count; r++) {
+        _clipX0 = (regions[r][0] > 0) ? regions[r][0] : 0;
+        _clipX1 = (regions[r][2] < _width) ? regions[r][2] : _width;
+        _clipY0 = (regions[r][1] > y0) ? regions[r][1] : y0;
+        _clipY1 = (regions[r][3] < y1) ? regions[r][3] : y1;
+        if (_clipX0 >= _clipX1 || _clipY0 >= _clipY1) continue;
+        if (clear) _clearClip();
+        for (uint8_t i = 0; i < count; i++) {
+            const DisplayListItem &item = items[i];
+            if (item.x0 >= _clipX1 || item.x1 <= _clipX0 || item.y0 >= _clipY1 || item.y1 <= _clipY0) continue;
+            _listDraw(item, segments);
+            drawn++;
+        }
+    }
+    return drawn;
+}
+
+uint8_t SavaOLED_ESP32::_rasterFrame(const DisplayListItem* items, uint8_t count, const TextSegment* segments,
+                                     const int16_t (*regions)[4], uint8_t region_count, bool clear) {
+    _rasterSplit = _rasterTaskHandle ? _rasterSplitPage(items, count, regions, region_count) : 0;
+    if (_rasterSplit == 0) return _rasterRegions(items, count, segments, regions, region_count, clear, 0, _height);
+
+    // Оба ядра пишут в один кадр: граница полос идёт по странице, а каждая запись примитива ограничена
+    // страницами своего окна отсечения, поэтому ни один байт не достаётся двум ядрам
+    _rasterHelper->_target = _buffer.get();
+    _rasterJobItems = items;
+    _rasterJobCount = count;
+    _rasterJobSegments = segments;
+    _rasterJobRegions = regions;
+    _rasterJobRegionCount = region_count;
+    _rasterJobClear = clear;
+    xTaskNotifyGive(_rasterTaskHandle);
+
+    uint8_t drawn = _rasterRegions(items, count, segments, regions, region_count, clear, 0, _rasterSplit * 8);
+
+    xSemaphoreTake(_rasterDone, portMAX_DELAY); // соединение полос до отправки кадра
+    return drawn + _rasterJobDrawn;
+}
+
+uint8_t SavaOLED_ESP32::_rasterSplitPage(const DisplayListItem* items, uint8_t count, const int16_t (*regions)[4], uint8_t region_count) const {
+    // Работа страницы - площадь команд (в пределах областей), попадающая в её строки
+    const uint8_t pages = _height / 8;
+    uint32_t cost[32] = { 0 };
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        const DisplayListItem &item = items[i];
+        // Бегущая строка сдвигается по времени: на двух ядрах её половины разошлись бы на шаг
+        if (item.type == DL_TEXT && (item.flags & 0x80)) return 0;
+        for (uint8_t r = 0; r < region_count; r++) {
+            int16_t x0 = (item.x0 > regions[r][0]) ? item.x0 : regions[r][0];
+            int16_t x1 = (item.x1 < regions[r][2]) ? item.x1 : regions[r][2];
+            int16_t y0 = (item.y0 > regions[r][1]) ? item.y0 : regions[r][1];
+            int16_t y1 = (item.y1 < regions[r][3]) ? item.y1 : regions[r][3];
+            if (x0 < 0) x0 = 0;
+            if (x1 > _width) x1 = _width;
+            if (y0 < 0) y0 = 0;
+            if (y1 > pages * 8) y1 = pages * 8;
+            if (x0 >= x1 || y0 >= y1) continue;
+            for (int16_t page = y0 >> 3; page <= (y1 - 1) >> 3; page++) {
+                int16_t rows = ((y1 < (page + 1) * 8) ? y1 : (page + 1) * 8) - ((y0 > page * 8) ? y0 : page * 8);
+                cost[page] += (uint32_t)(x1 - x0) * rows;
+                total += (uint32_t)(x1 - x0) * rows;
+            }
+        }
+    }
+    if (total < RASTER_MIN_AREA) return 0; // пробуждение второго ядра дороже самого рисования
+
+    // Граница, при которой большая из двух полос наименьшая
+    uint8_t best = 0;
+    uint32_t best_load = total;
+    uint32_t top = 0;
+    for (uint8_t split = 1; split < pages; split++) {
+        top += cost[split - 1];
+        uint32_t load = (top > total - top) ? top : (total - top);
+        if (load < best_load) { best_load = load; best = split; }
+    }
+    // Вся работа в одной странице - делить нечего
+    return (best_load < total) ? best : 0;
+}
+
+void SavaOLED_ESP32::_rasterTaskEntry(void* arg) {
+    static_cast<SavaOLED_ESP32*>(arg)->_rasterLoop();
+}
+
+void SavaOLED_ESP32::_rasterLoop() {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (_rasterStop) break;
+        _rasterJobDrawn = _rasterHelper->_rasterRegions(_rasterJobItems, _rasterJobCount, _rasterJobSegments,
+                                                        _rasterJobRegions, _rasterJobRegionCount, _rasterJobClear,
+                                                        _rasterSplit * 8, _height);
+        xSemaphoreGive(_rasterDone);
+    }
+    xSemaphoreGive(_rasterDone);
+    vTaskDelete(NULL);
+}
+
+void SavaOLED_ESP32::_clearClip() {
+    int16_t clip_y1 = (_clipY1 < (_height / 8) * 8) ? _clipY1 : (_height / 8) * 8;
+    if (_clipX0 >= _clipX1 || _clipY0 >= clip_y1) return;
+    for (int16_t page = _clipY0 >> 3; page <= (clip_y1 - 1) >> 3; page++) {
+        uint8_t mask = page_rows_mask(page, _clipY0, clip_y1);
+        uint8_t* row = _pageRow(page);
+        if (mask == 0xFF) {
+            memset(row + _clipX0, 0, _clipX1 - _clipX0);
+        } else {
+            for (int16_t x = _clipX0; x < _clipX1; x++) row[x] &= ~mask;
+        }
+    }
+}
+
 void SavaOLED_ESP32::_drawPixel(int16_t x, int16_t y, uint8_t mode) { // -- эта строку изменить
-    if (x < 0 || x >= _width || y < 0 || y >= _height) {
+    if (x < _clipX0 || x >= _clipX1 || y < _clipY0 || y >= _clipY1) {
         return;
     }
-    uint16_t byte_index = x + (y / 8) * _width;
-    uint8_t bit_pos = y % 8;
+    uint8_t &dest = _pageRow(y >> 3)[x];
+    uint8_t bit_pos = y & 7;
 
 	switch (mode) {
         case ERASE_BORDER:
 		case ADD_UP:
         case REPLACE: // Для одиночного белого пикселя REPLACE и ADD_UP делают одно и то же (ставят 1)
-            _buffer.get()[byte_index] |= (1 << bit_pos);
+            dest |= (1 << bit_pos);
             break;
         case INV_AUTO:
-            _buffer.get()[byte_index] ^= (1 << bit_pos);
+            dest ^= (1 << bit_pos);
             break;
         case ERASE: // Новый режим: принудительная очистка бита (рисуем черным)
-            _buffer.get()[byte_index] &= ~(1 << bit_pos);
+            dest &= ~(1 << bit_pos);
             break;
     }
 }
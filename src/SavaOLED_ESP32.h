@@ -7,11 +7,20 @@ v1.1.1 SavaLAB 2026
 #define SavaOLED_ESP32_h
 
 #include "SavaOLED_types.h"
+#include "SavaOLED_fmt.h"
+#include <atomic>
+#include <cmath>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include <Arduino.h>
 // Подключаем заголовочный файл нового нативного драйвера I2C
 #include "driver/i2c_master.h"
+// FreeRTOS: задача рендера и мьютекс потокобезопасного режима (renderTask)
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 
 // ============================================================
 // DEBUG LOGGING SYSTEM
@@ -30,23 +39,134 @@ v1.1.1 SavaLAB 2026
 
 
 
+// Диапазон кодовых точек Unicode [first, first + count) -> глифы [index, index + count)
+struct savaRange {
+    uint32_t first;            // Первая кодовая точка диапазона
+    uint16_t count;            // Количество символов в диапазоне
+    uint16_t index;            // Индекс глифа для first
+};
+
 struct savaFont {
     const uint8_t* data;       // Указатель на массив данных (Ширина + Байты)
     const uint16_t* offsets;   // Указатель на таблицу смещений (Где искать символ)
     uint8_t height;            // Высота символа в пикселях
-    uint8_t font_index;        // Тип: 0=Numbers (Спец), 1=General (ASCII+CP1251)
+    uint8_t font_index;        // Тип: 0=Numbers (Спец), 1=General (ASCII+CP1251); не используется, если задан ranges
+    const uint8_t* vmetrics = nullptr; // Вертикальные метрики [skip_top, real_height] на символ (для drawPrintVert), nullptr = считать на лету
+    const savaRange* ranges = nullptr; // Таблица диапазонов Unicode, отсортированная по first (nullptr = старая схема по font_index)
+    uint8_t range_count = 0;   // Количество диапазонов в ranges
 };
 
 struct TextSegment {
-    const char* text;          // Буфер для фрагмента текста (не владеет памятью)
+    const char* text;          // Текст фрагмента: в _textBuffer или внешняя строка (не владеет памятью)
     const savaFont* fontPtr;          // Указатель на шрифт для этого фрагмента
+    uint16_t length;           // Длина текста в байтах (без нуль-терминатора)
+    uint8_t scale;             // Целочисленный масштаб символов (1..4)
+    uint8_t drawMode;          // Режим отрисовки фрагмента (REPLACE, ADD_UP, INV_AUTO)
+};
+
+struct TextBoxLine {
+    uint16_t start;            // Начало строки в тексте (байты)
+    uint16_t length;           // Длина строки в байтах (без пробела/перевода строки на границе)
+};
+
+struct NumberWidget {
+    static const uint8_t MAX_CELLS = 12;   // Максимум знакомест
+    int16_t x, y;              // Левый верхний угол
+    const savaFont* fontPtr;   // Шрифт (обычно семисегментный)
+    uint8_t cells;             // Количество знакомест (текст выравнивается вправо)
+    uint8_t cellWidth;         // Ширина знакоместа: самая широкая цифра шрифта
+    uint8_t spacing;           // Интервал между знакоместами
+    uint8_t rollFrames;        // Промежуточных кадров прокрутки (0 = без анимации)
+    bool drawn;                // Знакоместа уже выведены на экран
+    uint32_t from[MAX_CELLS];  // Символ, с которого идёт прокрутка (кодовая точка)
+    uint32_t to[MAX_CELLS];    // Символ, который показывается / к которому идёт прокрутка
+    uint8_t phase[MAX_CELLS];  // Кадр прокрутки знакоместа (0 = покой)
+    int16_t dirtyX;            // Первая колонка, изменённая последним drawNumber()
+    int16_t dirtyWidth;        // Ширина изменённой области в пикселях (0 = ничего не менялось)
+    uint16_t dirtyCells;       // Изменённые знакоместа: бит N = знакоместо N (слева)
+};
+
+struct ChartWidget {
+    std::unique_ptr<float[]> samples; // Кольцо отсчётов: по одному на колонку и ещё один слева (w + 1), NAN - пропуск
+    int16_t x = 0, y = 0;      // Левый верхний угол области графика
+    uint8_t w = 0, h = 0;      // Размер области в пикселях
+    uint8_t style = CHART_LINE; // CHART_LINE, CHART_BAR или CHART_DOT
+    bool autoScale = false;    // Диапазон подбирается по отсчётам в кольце
+    float minY = 0, maxY = 0;  // Значения на нижней и верхней строке области
+    uint16_t head = 0;         // Куда запишется следующий отсчёт
+    uint16_t count = 0;        // Отсчётов в кольце
+    bool drawn = false;        // График выведен (false - следующий drawChart перерисует область целиком)
+};
+
+struct GlyphCacheEntry {
+    const savaFont* fontPtr;   // Шрифт символа (nullptr - пустой слот)
+    uint16_t index;            // Индекс символа в шрифте
+    uint16_t offset;           // Начало сдвинутых колонок в пуле кэша
+    uint8_t shift;             // Сдвиг по Y (1..7), для которого подготовлены колонки
+    uint8_t width;             // Ширина символа в колонках
 };
 
 struct DisplayListItem {
-    const uint8_t* font_data; // Указатель на начало данных символа
-    uint8_t char_width;       // Ширина этого символа в байтах/колонках
-    uint8_t mode;             // Режим заливки
-	const savaFont* fontPtr;		  // Указатель на шрифт для этого фрагмента
+    uint8_t type;              // Тип команды (DL_DOT ... DL_TEXT)
+    uint8_t mode;              // Режим отрисовки (для текста - у каждого фрагмента свой)
+    uint8_t flags;             // fill для фигур, выравнивание для текста
+    uint8_t count;             // Количество фрагментов текста
+    int16_t p[6];              // Параметры команды: координаты и размеры в порядке аргументов функции
+    const uint8_t* data;       // Картинка (drawBitmap / drawBitmapRLE)
+    uint16_t first;            // Первый фрагмент текста в пуле списка
+    int16_t x0, y0, x1, y1;    // Габариты на холсте (x1, y1 - не включительно)
+    uint32_t signature;        // Подпись входных данных команды
+};
+
+// Команда очереди post(): фиксированный размер, без указателей на временные данные - можно отправлять из любой задачи и ISR
+struct SavaCommand {
+    uint8_t type;              // Тип команды (CMD_DOT ... CMD_NUMBER)
+    uint8_t widget;            // Номер виджета 1..widgets (0 = без объединения): рисуется последняя команда виджета
+    uint8_t mode;              // Режим отрисовки
+    uint8_t flags;             // fill для фигур; выравнивание текста (биты 0..1) и знаков после запятой числа (биты 4..7)
+    int16_t x, y;              // Левый верхний угол / центр круга / первый конец линии
+    int16_t w, h;              // Размер; второй конец линии; w - радиус круга; для текста - стираемая область (w = 0 - не стирать)
+    const void* ref;           // Шрифт (CMD_TEXT, CMD_NUMBER) или данные картинки (должны жить до отрисовки)
+    union {
+        char text[SAVA_CMD_TEXT]; // Текст в UTF-8 с нулём в конце (CMD_TEXT)
+        float value;           // Число (CMD_NUMBER)
+    };
+};
+
+struct CommandSlot {
+    std::atomic<uint32_t> seq; // Номер записи: = позиция - слот свободен, = позиция + 1 - команда готова
+    SavaCommand cmd;
+};
+
+// Ячейка последней команды виджета: запись под нечётным seq, чтение без ожидания (seqlock)
+struct CommandBox {
+    static const uint8_t WORDS = (sizeof(SavaCommand) + 3) / 4;
+    std::atomic<uint32_t> seq;       // Чётный - команда целая, нечётный - идёт запись
+    std::atomic<bool> pending;       // В кольце уже есть отметка этого виджета
+    std::atomic<uint32_t> words[WORDS]; // Команда по 32-битным словам
+};
+
+// Холст вне экрана: тот же формат страниц, что и кадровый буфер (байт - 8 строк одной колонки)
+struct SavaCanvas {
+    std::unique_ptr<uint8_t[]> buffer; // (height / 8) страниц по width байт
+    uint8_t width = 0;         // Ширина в пикселях
+    uint8_t height = 0;        // Высота в пикселях (кратна 8)
+};
+
+// Слой композиции: холст размером с экран и режим его наложения на слои ниже
+struct SavaLayer {
+    SavaCanvas canvas;
+    uint8_t mode = ADD_UP;     // REPLACE, ADD_UP, INV_AUTO или ERASE
+    bool visible = true;       // Скрытый слой в кадр не попадает
+};
+
+// Область кадра, сохранённая под всплывающим окном (pushOverlay)
+struct OverlaySave {
+    uint16_t offset;           // Начало копии в пуле
+    int16_t x0;                // Первая колонка
+    uint8_t width;             // Ширина в колонках
+    uint8_t page0;             // Первая страница
+    uint8_t pages;             // Количество страниц (0 - окно целиком за экраном)
 };
 
 class SavaOLED_ESP32 {
@@ -58,8 +178,10 @@ public:
     * @param height - высота экрана в пикселях (по умолчанию 64).
     * @param segmentBufferSize - размер буфера сегмента/строки (по умолчанию 48).
     * @param port - i2c_port_t порт (I2C_NUM_0 или I2C_NUM_1).
+    * @param stripPages - сразу включить постраничный режим (pageMode) с полосой stripPages страниц:
+    * полный кадр и его копия для передачи не выделяются вовсе (0 = обычный кадровый буфер).
     */
-    SavaOLED_ESP32(uint8_t width = 128, uint8_t height = 64, i2c_port_t port = I2C_NUM_0);
+    SavaOLED_ESP32(uint8_t width = 128, uint8_t height = 64, i2c_port_t port = I2C_NUM_0, uint8_t stripPages = 0);
 	/**
     * @brief Деструктор. Освобождает все выделенные ресурсы.
     */
@@ -156,6 +278,29 @@ public:
     * @param fill - FILL = залить фигуру, NO_FILL = нарисовать контур.
     */
     void rectR(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint8_t mode = REPLACE, bool fill = NO_FILL);
+
+	/**
+    * @brief Инвертировать прямоугольную область (подсветка пункта меню). Одна запись по маске на байт.
+    */
+    void invertRect(int16_t x, int16_t y, int16_t w, int16_t h);
+
+	/**
+    * @brief Очистить прямоугольную область. Одна запись по маске на байт.
+    */
+    void clearRect(int16_t x, int16_t y, int16_t w, int16_t h);
+
+	/**
+    * @brief Скопировать область (x, y, w, h) в точку (toX, toY) той же цели рисования. Области могут
+    * перекрываться: результат - как у копии через промежуточный буфер. Часть области вне холста не копируется.
+    * Недоступно при записи списка, с renderTask и в pageMode (кроме рисования в холст).
+    */
+    void copyRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t toX, int16_t toY);
+
+	/**
+    * @brief Сдвинуть содержимое области на (dx, dy) внутри неё (журнал, бегущий график): ушедшее за край
+    * области теряется, освободившиеся строки и колонки очищаются. Ограничения - как у copyRect.
+    */
+    void scrollRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t dx, int16_t dy);
 	
 	 /**
     * @brief Нарисовать треугольник (контур или залитый).
@@ -179,11 +324,23 @@ public:
     *       Массив должен быть организован по колонкам.
     */
     void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint8_t mode = REPLACE);
+
+   /**
+    * @brief Нарисовать монохромный битмап, сжатый RLE (extras/tools/sava_font_rle.py --bitmap).
+    * Распаковка идёт на лету, без промежуточного буфера.
+    * @param x - X координата верхнего левого угла.
+    * @param y - Y координата верхнего левого угла.
+    * @param data - поток токенов RLE (после распаковки - тот же формат, что у drawBitmap).
+    * @param w - ширина битмапа в пикселях.
+    * @param h - высота битмапа в пикселях.
+    * @param mode - режим отрисовки (как у drawBitmap).
+    */
+    void drawBitmapRLE(int16_t x, int16_t y, const uint8_t* data, int16_t w, int16_t h, uint8_t mode = REPLACE);
 	
 	/**
     * @brief Быстро залить весь кадровый буфер повторяющимся узором.
     * @param pattern - байт-узор для вертикальной колонки из 8 пикселей.
-    * @note 0x00 - очистка, 0xFF - полная заливка, 0xAA/0x55 - шахматка.
+    * @note 0x00 - очистка, 0xFF - полная заливка, 0xAA/0x55 - шахматка. Недоступно с renderTask.
     */
     void fillScreen(uint8_t pattern);
 	
@@ -239,6 +396,13 @@ public:
     * @param spacing - количество пикселей между символами (по умолчанию 1).
     */ 
     void charSpacing(uint8_t spacing);
+
+	/**
+    * @brief Установить целочисленный масштаб текста для последующих print (только drawPrint).
+    * Символы растягиваются на лету из обычного шрифта: SF_Font_P8 с масштабом 2 заменяет SF_Font_x2_P16.
+    * @param scale - 1 (без масштаба), 2, 3 или 4. Высота символа после масштаба - не более 64 пикселей.
+    */
+    void textScale(uint8_t scale = 1);
 	
 	/**
     * @brief Включить/выключить режим скроллинга для текущей строки.
@@ -266,6 +430,24 @@ public:
     */ 
     void setBuffer(bool enabled);
 
+	/**
+    * @brief Включить кэш символов, заранее сдвинутых по Y (для строк с y не кратным 8).
+    * Для каждого символа хранится (страниц шрифта + 1) байт на колонку (16 бит для шрифтов до 8 пикселей),
+    * уже сдвинутых на y % 8: drawPrint копирует их без побитовых сдвигов. При заполнении кэш очищается целиком.
+    * @param maxBytes - предел памяти кэша в байтах (0 = выключить и освободить память). Сбрасывает счётчики.
+    */
+    void glyphCache(uint16_t maxBytes);
+
+	/**
+    * @brief Количество попаданий в кэш сдвинутых символов.
+    */
+    uint32_t getGlyphCacheHits() const;
+
+	/**
+    * @brief Количество промахов кэша сдвинутых символов (символ сдвигался и записывался в кэш).
+    */
+    uint32_t getGlyphCacheMisses() const;
+
 //#############################################################################################################################
 // --- Преобразование типов ---
 //#############################################################################################################################
@@ -275,6 +457,21 @@ public:
     * @param text - нуль-терминированная строка.
     */
 	void print(const char* text); 
+
+	/**
+    * @brief Добавить строку в буфер печати без копирования (только указатель и длина).
+    * Не занимает место в общем текстовом буфере. Строка должна существовать до вызова drawPrint()/drawPrintVert()
+    * (строковые литералы, const-массивы, пункты меню). Для временных строк используйте print().
+    * @param text - строка (не обязательно нуль-терминированная при явной длине).
+    * @param len - длина в байтах (по умолчанию strlen(text)).
+    */
+	void printRef(const char* text);
+	void printRef(const char* text, size_t len);
+
+	/**
+    * @brief Добавить строку из flash (F("...")) без копирования.
+    */
+	void print(const __FlashStringHelper* text);
     
 	/**
     * @brief Добавить целое число (int) в буфер печати с опциональным форматированием.
@@ -337,6 +534,18 @@ public:
     * @brief Добавить объект String в буфер печати.
     */
     void print(const String &s); 
+
+#ifdef SAVAOLED_HAS_PRINTFMT
+	/**
+    * @brief Форматированный вывод одним сегментом. Строка формата разбирается на этапе компиляции (C++20).
+    * Пример: oled.printFmt<"T: {:.1f}°C  H: {}%">(t, h);
+    * Поля: {} / {:03d} / {:.1f} / {:6.2f} / {:5s} / {:c}. Неверный формат или число аргументов — ошибка компиляции.
+    * Цифры пишутся прямо в буфер текста, без snprintf.
+    * @param args - целые (до 32 бит), float/double, строки (const char* и String), char, bool.
+    */
+	template <savaFmt::FixedString Fmt, typename... Args>
+	void printFmt(const Args&... args);
+#endif
 //#############################################################################################################################
 //#############################################################################################################################
     /**
@@ -347,10 +556,404 @@ public:
 	
     /**
     * @brief Вывод вертикального текста (сверху вниз).
-    * Использует текущие настройки шрифта. Шрифт должен быть повернут на 90 градусов.
+    * Использует текущие настройки шрифта. Шрифт должен быть повернут на 90 градусов. Недоступно с renderTask.
     */
     void drawPrintVert();
 
+	/**
+    * @brief Задать прямоугольник для многострочного текста (drawTextBox).
+    * @param x, y - левый верхний угол.
+    * @param w, h - ширина и высота области в пикселях.
+    * @param align - StrLeft, StrCenter или StrRight (для каждой строки).
+    * @param lineSpacing - отступ между строками в пикселях.
+    * @param wordWrap - true = перенос по словам, false = по символам.
+    */
+    void textBox(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t align = StrLeft, uint8_t lineSpacing = 1, bool wordWrap = true);
+
+	/**
+    * @brief Вывести текст в области textBox() с переносом строк.
+    * Переносы считаются один раз и хранятся, пока не изменятся текст, шрифт, масштаб, интервал или ширина области.
+    * Использует текущие шрифт, масштаб, интервал и режим отрисовки; сбрасывает накопленную строку print().
+    * Выводятся только строки, целиком помещающиеся по высоте. "\n" - принудительный перенос.
+    * @param text - строка UTF-8 (не копируется, до 65535 байт).
+    */
+    void drawTextBox(const char* text);
+
+	/**
+    * @brief Прокрутить textBox на целое число строк.
+    * @param lines - сколько строк пролистать (>0 - вниз, <0 - вверх). Ограничено началом и концом текста.
+    */
+    void textBoxScroll(int16_t lines);
+
+	/**
+    * @brief Количество строк текста после переноса (по последнему drawTextBox).
+    */
+    uint16_t getTextBoxLines() const;
+
+	/**
+    * @brief Номер первой видимой строки textBox.
+    */
+    uint16_t getTextBoxFirstLine() const;
+
+	/**
+    * @brief Настроить числовой индикатор (знакоместа с собственным состоянием, см. drawNumber).
+    * @param widget - состояние индикатора (хранится у пользователя, по одному на каждое число на экране).
+    * @param x, y - левый верхний угол.
+    * @param font - шрифт цифр (ширина знакоместа = самая широкая цифра, высота - до 32 пикселей).
+    * @param cells - количество знакомест (до NumberWidget::MAX_CELLS).
+    * @param rollFrames - промежуточных кадров прокрутки при смене цифры (0 = сразу новая цифра).
+    * @param spacing - интервал между знакоместами в пикселях.
+    */
+    void numberWidget(NumberWidget &widget, int16_t x, int16_t y, const savaFont &font, uint8_t cells, uint8_t rollFrames = 0, uint8_t spacing = 1);
+
+	/**
+    * @brief Вывести значение в числовой индикатор: перерисовываются только изменившиеся знакоместа.
+    * Текст выравнивается вправо по знакоместам. Смена символа прокручивается вверх (как в счётчике-одометре)
+    * за rollFrames + 1 вызовов: вызывайте каждый кадр, пока функция возвращает true.
+    * Изменённые этим вызовом знакоместа - битовая маска widget.dirtyCells, их общая область -
+    * widget.dirtyX / widget.dirtyWidth (высота - высота шрифта от widget.y).
+    * Знакоместа рисуются в режиме REPLACE. Недоступно с renderTask.
+    * @param widget - индикатор, настроенный numberWidget().
+    * @param text - строка UTF-8 (цифры, точка, знак и т.п.).
+    * @return true, если прокрутка ещё не закончена.
+    */
+    bool drawNumber(NumberWidget &widget, const char* text);
+
+	/**
+    * @brief Вывести целое число в числовой индикатор.
+    */
+    bool drawNumber(NumberWidget &widget, int32_t value);
+
+	/**
+    * @brief Вывести дробное число в числовой индикатор.
+    * @param decimals - знаков после запятой.
+    */
+    bool drawNumber(NumberWidget &widget, float value, uint8_t decimals);
+
+	/**
+    * @brief Настроить бегущий график (кольцо отсчётов, по отсчёту на колонку, см. drawChart).
+    * @param chart - состояние графика (хранится у пользователя).
+    * @param x, y, w, h - область графика.
+    * @param style - CHART_LINE, CHART_BAR или CHART_DOT.
+    * @param minY, maxY - значения на нижней и верхней строке; minY == maxY - автомасштаб по отсчётам.
+    * @return true, если память под кольцо выделена.
+    */
+    bool chartWidget(ChartWidget &chart, int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t style = CHART_LINE, float minY = 0, float maxY = 0);
+
+	/**
+    * @brief Добавить отсчёт: область сдвигается на колонку влево (memmove по страницам), рисуется только новая колонка.
+    * Область перерисовывается целиком при первом выводе и при смене диапазона автомасштабом.
+    * Рисует в текущую цель (экран, холст, слой); недоступно при записи списка, с renderTask и в pageMode.
+    * @param value - значение (NAN - пропуск).
+    * @return true, если область перерисована целиком (диапазон изменился - подписи оси нужно обновить).
+    */
+    bool drawChart(ChartWidget &chart, float value);
+
+	/**
+    * @brief Нарисовать ось графика: линии слева и снизу и подписи maxY / minY слева от области (колонки слева
+    * от области в её строках очищаются). Удобно рисовать в отдельный слой, который не меняется между кадрами.
+    * Подписи рисуются шрифтом labelFont в REPLACE; шрифт, курсор, режим и ещё не нарисованные print()
+    * сохраняются. Если левее области меньше 4 колонок, подписи не рисуются.
+    * @param decimals - знаков после запятой в подписях.
+    */
+    void drawChartAxis(const ChartWidget &chart, const savaFont &labelFont, uint8_t decimals = 0);
+
+	/**
+    * @brief Выделить память под список отображения (listBegin / listEnd).
+    * @param maxItems - максимум команд в кадре (0 = выключить и освободить память).
+    * @param textBytes - буфер для копий текста строк drawPrint (байт на кадр).
+    */
+    void displayList(uint8_t maxItems, uint16_t textBytes = 256);
+
+	/**
+    * @brief Начать запись кадра в список отображения.
+    * До listEnd() функции dot, line, hLine, vLine, rect, rectR, circle, bezier, drawPeak, drawBitmap,
+    * drawBitmapRLE, drawPrint и drawTextBox не рисуют, а записывают команды с их габаритами; clear() игнорируется.
+    */
+    void listBegin();
+
+	/**
+    * @brief Закончить запись и перерисовать изменившееся.
+    * Команды сравниваются с предыдущим кадром по порядку: область изменённой команды (старые и новые габариты)
+    * очищается, и в ней заново рисуются все команды, которые её касаются, в порядке записи.
+    * Остальной кадр не трогается. Первый кадр (и кадр после listInvalidate) рисуется целиком.
+    * @return true, если в кадровом буфере что-то изменилось.
+    */
+    bool listEnd();
+
+	/**
+    * @brief Перерисовать следующий кадр списка целиком (после рисования поверх списка без него).
+    */
+    void listInvalidate();
+
+	/**
+    * @brief Постраничный режим без кадрового буфера (как page mode в u8g2).
+    * Вместо кадра (ширина x высота / 8 байт) и его копии для передачи хранится полоса stripPages страниц
+    * и буфер одной страницы. Кадр описывается списком отображения: listEnd() собирает из команд только полосы
+    * с изменениями (каждая команда отсекается по полосе) и сразу отправляет их на дисплей; display() - весь кадр.
+    * Рисование без списка попадает только в текущую полосу. Недоступен с canvasRotation.
+    * Буфер строки в этом режиме шириной с экран и выделяется при первом drawPrint() (бегущая строка расширяет его
+    * до полного). Чтобы полный кадр не выделялся вовсе, полосу можно задать сразу в конструкторе.
+    * @param stripPages - высота полосы в страницах по 8 строк (0 или >= высоты экрана - обычный кадровый буфер).
+    */
+    void pageMode(uint8_t stripPages);
+
+	/**
+    * @brief Память буферов экрана в байтах (для сравнения режимов): кадр или полоса, буфер передачи, кадр поворота,
+    * буфер строки, буфер вертикального текста и список отображения (те, что выделены).
+    */
+    uint32_t getBufferBytes() const;
+
+	/**
+    * @brief Потокобезопасный режим: задача рендера на ядре core владеет кадровым буфером и сама отправляет кадры.
+    * Другие задачи рисуют только между frameBegin() и frameEnd(): команды записываются в очередь (память списка
+    * отображения, см. displayList) и рисуются задачей рендера порцией целиком, поэтому на экран не попадает
+    * наполовину нарисованный кадр. Передача по I2C идёт без блокировки: пока кадр уходит на дисплей, задачи пишут следующий.
+    * Недоступен с pageMode и listBegin / listEnd.
+    * @param core - ядро для задачи (0 или 1).
+    * @param priority - приоритет задачи FreeRTOS.
+    * @param stackBytes - стек задачи в байтах. По умолчанию 8 КБ, как у loopTask: в задаче рендера вложены
+    * растеризация текста (масштаб - 512 байт на стеке), печать чисел, логи Serial.printf и драйвер I2C.
+    * @return true, если задача запущена.
+    */
+    bool renderTask(uint8_t core = 1, uint8_t priority = 2, uint32_t stackBytes = RENDER_TASK_STACK);
+
+	/**
+    * @brief Остановить задачу рендера (очередь дорисовывается и отправляется) и вернуться в обычный режим.
+    */
+    void renderStop();
+
+	/**
+    * @brief Начать порцию команд: захватить библиотеку для текущей задачи (другие задачи ждут frameEnd).
+    * Если очередь заполнена больше чем наполовину, ждёт, пока задача рендера её нарисует.
+    * Без задачи рендера ничего не делает.
+    */
+    void frameBegin();
+
+	/**
+    * @brief Закончить порцию: команды становятся видны задаче рендера целиком, задача будится.
+    * Порция, не поместившаяся в очередь, отбрасывается целиком. Без задачи рендера - то же, что display().
+    */
+    void frameEnd();
+
+	/**
+    * @brief Кадров, собранных и отправленных задачей рендера (из других задач читать между frameBegin и frameEnd).
+    */
+    uint32_t getRenderFrames() const;
+
+	/**
+    * @brief Порций, отброшенных из-за переполнения очереди.
+    */
+    uint32_t getRenderDropped() const;
+
+	/**
+    * @brief Выделить кольцевую очередь команд для post() (ёмкость округляется вверх до степени двойки).
+    * Очередь без блокировок: команды из задач и прерываний рисует владелец экрана - задача рендера (renderTask)
+    * или display() перед отправкой кадра. Недоступна в pageMode.
+    * @param capacity - ёмкость кольца в командах (0 = выключить и освободить память).
+    * @param widgets - виджетов с объединением обновлений (номера 1..widgets), по ячейке на виджет.
+    * @return true, если очередь создана.
+    */
+    bool commandQueue(uint16_t capacity, uint8_t widgets = 16);
+
+	/**
+    * @brief Поставить команду в очередь (без блокировок, можно из ISR).
+    * Команда виджета (widget 1..widgets) заменяет его ещё не нарисованную команду: в кольце виджет занимает
+    * не больше одного места, и последнее значение не теряется при заполненном кольце.
+    * @return false, если кольцо заполнено (команда отброшена и учтена в getQueueDropped).
+    */
+    bool post(const SavaCommand &cmd);
+
+	/**
+    * @brief Обновить текст виджета: стереть область w x h (если w > 0) и вывести text шрифтом font.
+    * Текст копируется в команду (до SAVA_CMD_TEXT - 1 байт, длиннее - обрезается по границе символа).
+    * @param align - выравнивание в области шириной w (StrLeft / StrCenter / StrRight).
+    */
+    bool postText(uint8_t widget, int16_t x, int16_t y, int16_t w, int16_t h, const savaFont &font, const char* text,
+                  uint8_t align = StrLeft, uint8_t mode = REPLACE);
+
+	/**
+    * @brief Обновить число виджета: как postText, но форматирование (decimals знаков) делает владелец экрана.
+    */
+    bool postNumber(uint8_t widget, int16_t x, int16_t y, int16_t w, int16_t h, const savaFont &font, float value,
+                    uint8_t decimals = 1, uint8_t align = StrLeft, uint8_t mode = REPLACE);
+
+	/**
+    * @brief Прямоугольник через очередь (см. rect).
+    */
+    bool postRect(uint8_t widget, int16_t x, int16_t y, int16_t w, int16_t h, uint8_t mode = REPLACE, bool fill = NO_FILL);
+
+	/**
+    * @brief Картинка через очередь (см. drawBitmap): в команде только указатель, данные должны жить до отрисовки.
+    */
+    bool postBitmap(uint8_t widget, int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h, uint8_t mode = REPLACE);
+
+	/**
+    * @brief Команд в очереди сейчас.
+    */
+    uint16_t getQueueDepth() const;
+
+	/**
+    * @brief Наибольшее число команд, забранных из очереди за раз (для подбора ёмкости).
+    */
+    uint16_t getQueuePeak() const;
+
+	/**
+    * @brief Команд, отброшенных из-за заполненной очереди.
+    */
+    uint32_t getQueueDropped() const;
+
+	/**
+    * @brief Команд виджетов, заменённых более новыми до отрисовки.
+    */
+    uint32_t getQueueCoalesced() const;
+
+	/**
+    * @brief Растеризация списка отображения на двух ядрах.
+    * Кадр делится на две горизонтальные полосы страниц: верхнюю рисует вызывающая задача, нижнюю - задача
+    * на ядре helperCore со своим буфером строки, курсором и окном отсечения. Обе рисуют все команды, касающиеся
+    * их полосы, с отсечением по полосе, поэтому записи не пересекаются и блокировки не нужны; перед отправкой
+    * кадра полосы соединяются. Граница выбирается по площади команд в каждой полосе.
+    * Работает для listEnd() и задачи рендера (renderTask); лёгкие кадры и бегущие строки рисуются одним ядром.
+    * Вызывать до renderTask. В pageMode не используется.
+    * @param cores - 2 = включить, 1 = выключить и освободить память второго ядра (буфер строки 8 КБ, стек задачи
+    * и копия glyphCache, если он включён).
+    * @param helperCore - ядро задачи нижней полосы (loop() и renderTask по умолчанию работают на ядре 1).
+    * @param priority - приоритет задачи FreeRTOS.
+    * @param stackBytes - стек задачи нижней полосы в байтах. По умолчанию 8 КБ, как у loopTask: она рисует те же
+    * команды, что и задача рендера (_listDraw -> drawPrint, печать чисел, логи).
+    * @return true, если режим установлен.
+    */
+    bool rasterCores(uint8_t cores, uint8_t helperCore = 0, uint8_t priority = 2, uint32_t stackBytes = RASTER_TASK_STACK);
+
+	/**
+    * @brief Первая страница нижней полосы в последнем кадре (0 - кадр нарисован одним ядром).
+    */
+    uint8_t getRasterSplit() const;
+
+	/**
+    * @brief Выделить холст вне экрана (очищенный). Холст рисуется теми же функциями, что и экран (canvasBegin),
+    * и выводится на экран или другой холст за одну запись на байт (drawCanvas).
+    * @param height - высота в пикселях, округляется вверх до кратной 8.
+    * @return true, если память выделена.
+    */
+    bool canvas(SavaCanvas &canvas, uint8_t width, uint8_t height);
+
+	/**
+    * @brief Направить рисование в холст: все примитивы, текст, clear() и fillScreen() работают с ним,
+    * размер экрана для них - размер холста. Недоступно при записи списка и с renderTask.
+    */
+    void canvasBegin(SavaCanvas &canvas);
+
+	/**
+    * @brief Вернуть рисование на экран.
+    */
+    void canvasEnd();
+
+	/**
+    * @brief Вывести холст в точку (x, y) текущей цели рисования (экран или другой холст).
+    * Страницы холста сдвигаются на y % 8 целыми байтами; строки за пределами холста и окна отсечения не меняются.
+    * @param mode - REPLACE (холст целиком, с фоном), ADD_UP (только точки), INV_AUTO (инверсия по точкам), ERASE (стереть по точкам).
+    */
+    void drawCanvas(const SavaCanvas &canvas, int16_t x, int16_t y, uint8_t mode = REPLACE);
+
+	/**
+    * @brief Включить слои: count холстов размером с экран (слой 0 - нижний). display() собирает кадр из видимых
+    * слоёв пословно (по 32 бита) и только в страницах, изменённых с прошлой сборки; неизменные слои
+    * (фон, рамки, подписи) не перерисовываются. Слой 0 накладывается как REPLACE, остальные - ADD_UP.
+    * Недоступно в pageMode, с canvasRotation и renderTask.
+    * @param count - число слоёв до SAVA_MAX_LAYERS (0 - выключить и освободить память).
+    * @return true, если память выделена.
+    */
+    bool layers(uint8_t count);
+
+	/**
+    * @brief Рисовать в слой (как canvasBegin). Рисование, clear() и fillScreen() отсекаются по строкам [y, y + h):
+    * только страницы этих строк будут собраны заново.
+    * @param h - высота области (0 - до низа экрана).
+    */
+    void layerBegin(uint8_t layer, int16_t y = 0, int16_t h = 0);
+
+	/**
+    * @brief Вернуть рисование на экран.
+    */
+    void layerEnd();
+
+	/**
+    * @brief Режим наложения слоя на слои ниже: REPLACE (слой непрозрачный), ADD_UP (точки поверх),
+    * INV_AUTO (инверсия под точками), ERASE (стирание под точками).
+    */
+    void layerMode(uint8_t layer, uint8_t mode);
+
+	/**
+    * @brief Показать или скрыть слой.
+    */
+    void layerVisible(uint8_t layer, bool visible);
+
+	/**
+    * @brief Количество слоёв (0 - слои выключены).
+    */
+    uint8_t getLayerCount() const;
+
+	/**
+    * @brief Сколько страниц было собрано из слоёв при последней сборке кадра.
+    */
+    uint8_t getComposedPages() const;
+
+	/**
+    * @brief Выделить пул для сохранения кадра под всплывающими окнами (pushOverlay / popOverlay).
+    * Память фиксирована: окно, которому не хватило пула или глубины стека, не сохраняется.
+    * @param bytes - размер пула в байтах (окно w x h занимает w * число задетых страниц). 0 - освободить.
+    * @param depth - сколько окон может быть открыто одновременно.
+    * @return true, если память выделена.
+    */
+    bool overlayPool(uint16_t bytes, uint8_t depth = 4);
+
+	/**
+    * @brief Сохранить область кадра под окном (страницы и колонки, задетые прямоугольником) перед его рисованием.
+    * Недоступно в pageMode, с renderTask, слоями и во время canvasBegin.
+    * @return false, если пул переполнен (окно не сохранено, счётчик getOverlayOverflows()).
+    */
+    bool pushOverlay(int16_t x, int16_t y, int16_t w, int16_t h);
+
+	/**
+    * @brief Закрыть последнее окно: вернуть сохранённую область байт в байт.
+    * Недоступно там же, где pushOverlay.
+    * @param transmit - сразу отправить на дисплей только эту область (с canvasRotation - весь кадр).
+    * @return false, если открытых окон нет.
+    */
+    bool popOverlay(bool transmit = true);
+
+	/**
+    * @brief Сколько окон сейчас открыто.
+    */
+    uint8_t getOverlayDepth() const;
+
+	/**
+    * @brief Занято байт пула.
+    */
+    uint16_t getOverlayUsed() const;
+
+	/**
+    * @brief Сколько окон не удалось сохранить из-за нехватки пула или глубины.
+    */
+    uint32_t getOverlayOverflows() const;
+
+	/**
+    * @brief Количество команд в последнем записанном кадре.
+    */
+    uint8_t getListItems() const;
+
+	/**
+    * @brief Количество команд, заново нарисованных последним listEnd().
+    */
+    uint8_t getListRedrawn() const;
+
+	/**
+    * @brief Общая область, изменённая последним listEnd() (w = 0 - ничего не менялось).
+    */
+    void getListDirty(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const;
+
 	/**
     * @brief Установить позицию курсора и режим выравнивания для следующих print().
     * @param x - координата X (точка привязки или левая граница).
@@ -380,11 +983,51 @@ public:
     */
     uint16_t getTextHeight() const;
 
+    /**
+    * @brief Измерить ширину строки без отрисовки.
+    * Суммирует ширины символов из таблицы шрифта за один проход по UTF-8, ничего не пишет в буферы.
+    * Результат совпадает с getTextWidth() после drawPrint() той же строки.
+    * @param text - строка UTF-8.
+    * @param font - шрифт.
+    * @param spacing - интервал между символами (как charSpacing).
+    * @param scale - масштаб (как textScale).
+    * @return ширина в пикселях (без интервала после последнего символа).
+    */
+    uint16_t measureText(const char* text, const savaFont &font, uint8_t spacing = 1, uint8_t scale = 1) const;
+
+    /**
+    * @brief Измерить ширину фрагмента строки заданной длины (без нуль-терминатора).
+    */
+    uint16_t measureText(const char* text, size_t len, const savaFont &font, uint8_t spacing = 1, uint8_t scale = 1) const;
+
+    /**
+    * @brief Измерить ширину строки из нескольких сегментов (у каждого свой шрифт и масштаб).
+    * @param segments - массив сегментов.
+    * @param count - количество сегментов.
+    * @param spacing - интервал между символами.
+    */
+    uint16_t measureText(const TextSegment* segments, uint8_t count, uint8_t spacing = 1) const;
+
+    /**
+    * @brief Измерить ширину строки, накопленной print() после cursor(), до вызова drawPrint().
+    */
+    uint16_t measureText() const;
+
     /**
     * @brief Получить ширину диапазона курсора.
     */
     uint16_t getScopeCursor() const;
 
+    /**
+    * @brief Получить ширину холста в пикселях (с учётом canvasRotation).
+    */
+    uint8_t getWidth() const;
+
+    /**
+    * @brief Получить высоту холста в пикселях (с учётом canvasRotation).
+    */
+    uint8_t getHeight() const;
+
     /**
      * @brief Проверить готовность дисплея к работе
      * @return true - дисплей инициализирован и готов, false - проблемы с I2C
@@ -424,7 +1067,23 @@ public:
     */
     void rotation(bool rotate180); 
 
+    /**
+    * @brief Повернуть логический холст на 90/270 градусов (портретный режим).
+    * Все примитивы и текст работают в повёрнутых координатах (ширина и высота меняются местами),
+    * кадр для панели собирается в display() транспонированием блоков 8x8.
+    * Кадровый буфер при смене режима очищается. Нужен 1 дополнительный буфер кадра (только при ROT_90/ROT_270).
+    * @param turn - ROT_0 (обычный), ROT_90 (панель повёрнута по часовой стрелке), ROT_270 (против часовой).
+    */
+    void canvasRotation(uint8_t turn);
+
 private:
+	/**
+    * @brief Конструктор растеризатора без I2C (помощник rasterCores): без кадрового буфера и буфера передачи,
+    * рисует в кадр основного объекта через _target. Свой у него только буфер строки.
+    * @param frameBuffers - false = не выделять _buffer и _tx_buffer.
+    */
+    SavaOLED_ESP32(uint8_t width, uint8_t height, i2c_port_t port, uint8_t stripPages, bool frameBuffers);
+
     // --- Внутренние функции ---
 	/**
     * @brief Отправить массив команд контроллеру через I2C.
@@ -433,13 +1092,295 @@ private:
     */
 	void _sendCommands(const uint8_t* cmds, uint8_t len);
 	/**
-    * @brief Получить индекс символа в шрифте по коду символа.
+    * @brief Зарезервировать место под новый сегмент в _textBuffer.
+    * @param len - длина текста сегмента без нуль-терминатора.
+    * @return указатель для записи текста или nullptr при переполнении.
+    */
+	char* _reserveSegment(size_t len);
+
+	/**
+    * @brief Завершить сегмент, записанный по адресу из _reserveSegment().
+    * @param len - фактическая длина записанного текста.
+    */
+	void _commitSegment(size_t len);
+
+	/**
+    * @brief Добавить сегмент, ссылающийся на text, с текущим шрифтом.
+    * @param text - начало текста.
+    * @param len - длина текста в байтах.
+    */
+	void _addSegment(const char* text, size_t len);
+
+	/**
+    * @brief Свободное место в _textBuffer для текста очередного сегмента (без нуль-терминатора).
+    */
+	uint16_t _freeTextSpace() const { return TEXT_BUFFER_SIZE - _textBufferPos - 1; }
+
+	/**
+    * @brief Завершить числовой сегмент: обрезать до max_len и проверить место в буфере.
+    * @param len - полная длина, которую вернул _emit*().
+    * @param max_len - предел длины (как у прежних буферов snprintf).
+    */
+	void _commitNumber(uint16_t len, uint16_t max_len);
+
+	/**
+    * @brief Записать целое число (как "%0Nld", без snprintf).
+    * Пишет не больше cap символов, возвращает полную длину результата.
+    * @param dest - куда писать.
+    * @param cap - сколько символов можно записать.
+    * @param negative - знак числа.
+    * @param magnitude - модуль числа.
+    * @param min_digits - минимальная ширина с учетом знака (дополняется нулями).
+    */
+	static uint16_t _emitInteger(char* dest, uint16_t cap, bool negative, uint32_t magnitude, uint8_t min_digits);
+
+	/**
+    * @brief Записать float (как "%0W.Df", без snprintf и без перехода через double).
+    * Округление точное, половина -> к чётному (как в printf). decimals ограничено 9.
+    * Пишет не больше cap символов, возвращает полную длину результата.
+    */
+	static uint16_t _emitFloat(char* dest, uint16_t cap, float value, uint8_t decimals, uint8_t min_width);
+
+	/**
+    * @brief Записать double (как "%0W.Df", без snprintf). См. _emitFloat().
+    */
+	static uint16_t _emitDouble(char* dest, uint16_t cap, double value, uint8_t decimals, uint8_t min_width);
+
+#ifdef SAVAOLED_HAS_PRINTFMT
+	/**
+    * @brief Дописать len байт из src в позицию pos (не дальше cap), сдвинуть pos.
+    */
+	static void _fmtPut(char* dest, uint16_t cap, uint16_t &pos, const char* src, uint16_t len);
+
+	/**
+    * @brief Записать один аргумент printFmt согласно полю S (проверка типа — на этапе компиляции).
+    */
+	template <savaFmt::Spec S, typename T>
+	static void _fmtArg(char* dest, uint16_t cap, uint16_t &pos, const T& value);
+#endif
+
+	/**
+    * @brief Получить индекс символа в шрифте по кодовой точке Unicode.
+    * Для шрифтов с таблицей ranges - двоичный поиск по диапазонам,
+    * для старых шрифтов - перевод в CP1251 и схема по font_index.
+    * Отсутствующие не-ASCII символы заменяются глифом '?' (если он есть в шрифте).
     * @param fontPtr - указатель на используемый шрифт.
-    * @param char_code - код символа (может быть CP1251 для кириллицы).
+    * @param code_point - кодовая точка Unicode.
     * @return индекс в таблице шрифта или 0xFFFF если символ не найден.
     */
-	uint16_t _getCharIndex(const savaFont* fontPtr, uint16_t char_code);
+	uint16_t _getCharIndex(const savaFont* fontPtr, uint32_t code_point) const;
+
+	/**
+    * @brief Сумма ширин символов фрагмента по байтам ширины из таблицы шрифта (без отрисовки).
+    * @return ширина с интервалом после каждого символа, включая последний.
+    */
+	uint32_t _measureRun(const char* text, uint16_t length, const savaFont* fontPtr, uint8_t spacing, uint8_t scale) const;
+
+	/**
+    * @brief Нарисовать знакоместо индикатора: символ from, сдвинутый вверх на offset строк, под ним символ to.
+    */
+	void _drawNumberCell(const NumberWidget &widget, uint8_t cell, uint8_t offset);
+
+	/**
+    * @brief Нарисовать колонку графика col для отсчёта value (prev - предыдущий отсчёт, для CHART_LINE).
+    */
+	void _drawChartColumn(const ChartWidget &chart, int16_t col, float prev, float value);
+
+	/**
+    * @brief Найти в кэше (или подготовить) колонки символа, сдвинутые вниз на shift бит.
+    * @return указатель на pages_per_char + 1 строк по width байт или nullptr (кэш выключен / символ больше кэша).
+    */
+	const uint8_t* _cachedShiftedGlyph(const savaFont* fontPtr, uint16_t index, const uint8_t* char_ptr, uint8_t pages_per_char, uint8_t shift);
+
+	/**
+    * @brief Получить вертикальные метрики символа (для drawPrintVert).
+    * Берёт готовые значения из таблицы fontPtr->vmetrics, если она есть,
+    * иначе вычисляет их по OR всех колонок символа.
+    * @param fontPtr - указатель на используемый шрифт.
+    * @param index - индекс символа в шрифте.
+    * @param skip_top - [out] количество пустых строк сверху (== height для пробела).
+    * @param real_height - [out] высота видимой части символа.
+    */
+	void _getVertMetrics(const savaFont* fontPtr, uint16_t index, uint8_t &skip_top, uint8_t &real_height);
+
+	/**
+    * @brief Разбить текст на строки по ширине _boxW (результат - в _boxLines).
+    * @param text - строка UTF-8.
+    * @param length - длина строки в байтах.
+    */
+	void _layoutTextBox(const char* text, uint16_t length);
+
+	/**
+    * @brief Подпись (хеш) текущих сегментов для drawPrintVert: текст, шрифты и интервал.
+    * Лента перерисовывается только при изменении подписи.
+    */
+	uint32_t _vertTextSignature() const;
+
+	/**
+    * @brief Отрисовать текущие сегменты в вертикальную ленту _vertBuffer (по колонкам).
+    * Каждый символ берётся из шрифта своего сегмента.
+    */
+	void _renderVertTape();
+
+	/**
+    * @brief Прочитать 8 бит колонки ленты, начиная с пикселя src_y.
+    * @param col - колонка ленты.
+    * @param src_y - вертикальная позиция в ленте (может быть отрицательной).
+    * @param data - [out] биты изображения.
+    * @param mask - [out] биты, попадающие внутрь текста (0 за пределами ленты).
+    */
+	void _fetchVertTape(uint8_t col, int32_t src_y, uint8_t &data, uint8_t &mask) const;
 	
+	/**
+    * @brief Записать команду в список отображения.
+    * @return слот команды (габариты и тип уже заполнены) или nullptr, если список переполнен.
+    */
+	DisplayListItem* _listAdd(uint8_t type, uint8_t mode, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
+	/**
+    * @brief Записать текущую строку drawPrint (фрагменты и текст копируются в пул списка).
+    */
+	void _listAddText();
+
+	/**
+    * @brief Подпись (хеш) входных данных команды: параметры, текст, содержимое картинки.
+    */
+	uint32_t _listSignature(const DisplayListItem &item) const;
+
+	/**
+    * @brief Нарисовать команду списка (с учётом текущего окна отсечения).
+    * @param segments - фрагменты текстовых команд (пул списка, которому принадлежит item).
+    */
+	void _listDraw(const DisplayListItem &item, const TextSegment* segments);
+
+	/**
+    * @brief Перерисовать последний кадр списка в областях dirty: в кадровом буфере или полосами (pageMode).
+    */
+	void _listReplay(const int16_t (*dirty)[4], uint8_t dirty_count);
+
+	/**
+    * @brief Нарисовать все команды последнего кадра, касающиеся окна отсечения.
+    */
+	void _listDrawClipped();
+
+	/**
+    * @brief Собрать и отправить полосы, задетые областями dirty (pageMode).
+    */
+	void _streamStrips(const int16_t (*dirty)[4], uint8_t dirty_count);
+
+	/**
+    * @brief Отправить колонки [x0, x1) страниц page .. page + pages - 1 экрана из буфера (полосы или кадра).
+    */
+	void _sendStrip(uint8_t page, uint8_t pages, int16_t x0, int16_t x1);
+
+	/**
+    * @brief Точка входа задачи рендера (arg - объект дисплея).
+    */
+	static void _renderTaskEntry(void* arg);
+
+	/**
+    * @brief Цикл задачи рендера: ждать frameEnd, нарисовать очередь, снять копию кадра, отправить её без блокировки.
+    */
+	void _renderLoop();
+
+	/**
+    * @brief Нарисовать команды очереди в кадровый буфер и очистить очередь (под мьютексом).
+    */
+	void _renderDrain();
+
+	/**
+    * @brief Отправить копию кадра, уже лежащую в _tx_buffer[1..] (целиком или по страницам, как display()).
+    */
+	void _sendSnapshot();
+
+	/**
+    * @brief Забрать и нарисовать готовые команды очереди post() (владелец экрана).
+    * @return true, если что-то нарисовано.
+    */
+	bool _drainCommands();
+
+	/**
+    * @brief Занять слот кольца и опубликовать команду.
+    */
+	bool _pushCommand(const SavaCommand &cmd);
+
+	/**
+    * @brief Нарисовать одну команду очереди.
+    */
+	void _drawCommand(const SavaCommand &cmd);
+
+	/**
+    * @brief Разбудить задачу рендера после post() (из задачи или из ISR).
+    */
+	void _wakeRender();
+
+	/**
+    * @brief Нарисовать команды items в областях regions, ограниченных строками [y0, y1) (полоса ядра).
+    * @param clear - очищать область перед рисованием (перерисовка списка).
+    * @return сколько раз команды рисовались.
+    */
+	uint8_t _rasterRegions(const DisplayListItem* items, uint8_t count, const TextSegment* segments,
+	                       const int16_t (*regions)[4], uint8_t region_count, bool clear, int16_t y0, int16_t y1);
+
+	/**
+    * @brief Нарисовать команды в областях regions одним или двумя ядрами (см. rasterCores) и дождаться обоих.
+    * @return сколько раз команды рисовались.
+    */
+	uint8_t _rasterFrame(const DisplayListItem* items, uint8_t count, const TextSegment* segments,
+	                     const int16_t (*regions)[4], uint8_t region_count, bool clear);
+
+	/**
+    * @brief Граница полос по площади команд в каждой странице.
+    * @return первая страница нижней полосы или 0, если кадр выгоднее нарисовать одним ядром.
+    */
+	uint8_t _rasterSplitPage(const DisplayListItem* items, uint8_t count, const int16_t (*regions)[4], uint8_t region_count) const;
+
+	/**
+    * @brief Точка входа задачи нижней полосы (arg - объект дисплея).
+    */
+	static void _rasterTaskEntry(void* arg);
+
+	/**
+    * @brief Цикл задачи нижней полосы: ждать кадр, нарисовать полосу, сообщить о готовности.
+    */
+	void _rasterLoop();
+
+	/**
+    * @brief Очистить окно отсечения в кадровом буфере.
+    */
+	void _clearClip();
+
+	/**
+    * @brief Окно отсечения - весь холст (в постраничном режиме - строки текущей полосы).
+    */
+	void _resetClip();
+
+	/**
+    * @brief Начало страницы page цели рисования: _buffer или холст canvasBegin (в постраничном режиме буфер
+    * начинается со страницы _bufferPage0).
+    */
+	uint8_t* _pageRow(int16_t page) { return _target + (page - _bufferPage0) * _width; }
+
+	/**
+    * @brief Заполнить байтом pattern окно отсечения цели рисования (clear / fillScreen).
+    */
+	void _fillClip(uint8_t pattern);
+
+	/**
+    * @brief Залитый прямоугольник по маскам страниц (rect FILL, invertRect, clearRect), с отсечением.
+    */
+	void _fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t mode);
+
+	/**
+    * @brief Собрать из слоёв изменённые страницы кадра (_layerDirty).
+    */
+	void _composeLayers();
+
+	/**
+    * @brief Отметить страницы строк [y0, y1) для сборки из слоёв.
+    */
+	void _markLayerRows(int16_t y0, int16_t y1);
+
 	/**
     * @brief Внутренняя функция для отрисовки пикселя с разными режимами.
     * @param x - координата X.
@@ -458,8 +1399,13 @@ private:
     */
 	void _drawQuarterCircle(int16_t x0, int16_t y0, int16_t r, uint8_t corner, uint8_t mode);
     
-	void _displayPaged();       						/**< @brief Отправка буфера по страницам (стабильный метод) */ 
-    void _displayFullBuffer();  						/**< @brief Отправка буфера целиком (быстрый метод) */
+	void _displayPaged(const uint8_t* frame);       	/**< @brief Отправка кадра по страницам (стабильный метод) */ 
+    void _displayFullBuffer(const uint8_t* frame);  	/**< @brief Отправка кадра целиком (быстрый метод) */
+
+	/**
+    * @brief Кадр в формате панели: _buffer как есть или повёрнутый холст, собранный в _rotBuffer.
+    */
+	const uint8_t* _panelFrame();
 
 	
     // --- Переменные ---
@@ -488,9 +1434,89 @@ private:
     uint8_t _vertScrollSpeed;       					/**< @brief Скорость вертикального скролла (1..10) */
 	
 	std::unique_ptr<uint8_t[]> _lineBuffer;             //uint8_t* _lineBuffer;	/**< @brief Временный бинарный буфер для рендеринга строки (по колонкам) */
-    uint16_t _lineBufferWidth;      					/**< @brief Ширина _lineBuffer в колонках */
+    uint16_t _lineBufferWidth;      					/**< @brief Ширина _lineBuffer в колонках (0 - не выделен) */
+    static const uint16_t LINE_BUFFER_WIDTH = 1024;     /**< @brief Полная ширина _lineBuffer: длиннее строка обрезается */
+    int16_t _lineOrigin;                                /**< @brief Колонка строки в колонке 0 _lineBuffer (в pageMode - начало видимого окна) */
     uint8_t  _lineBufferHeightPages;					/**< @brief Высота _lineBuffer в страницах (8-строчных блоков) */
+    static const uint8_t LINE_BUFFER_PAGES = 8;         /**< @brief Выделенная высота _lineBuffer в страницах (64 пикселя) */
     uint16_t _currentLineWidth;     					/**< @brief Фактическая ширина отрисованной строки в _lineBuffer */
+    uint8_t _lineShift;                                 /**< @brief Сдвиг строки в _lineBuffer по Y (_cursorY % 8, 0 = не сдвинута) */
+
+    static const uint8_t GLYPH_CACHE_SLOTS = 64;        /**< @brief Слотов в таблице кэша сдвинутых символов (степень двойки) */
+    std::unique_ptr<GlyphCacheEntry[]> _glyphSlots;     /**< @brief Таблица кэша: прямое отображение (шрифт, символ, сдвиг) -> слот */
+    std::unique_ptr<uint8_t[]> _glyphPool;              /**< @brief Пул сдвинутых колонок */
+    uint16_t _glyphPoolSize;                            /**< @brief Размер пула в байтах */
+    uint16_t _glyphPoolUsed;                            /**< @brief Занято байт пула */
+    uint32_t _glyphCacheHits;                           /**< @brief Счётчик попаданий */
+    uint32_t _glyphCacheMisses;                         /**< @brief Счётчик промахов */
+
+    std::unique_ptr<DisplayListItem[]> _listItems;      /**< @brief Команды записываемого (после listEnd - последнего) кадра */
+    std::unique_ptr<DisplayListItem[]> _listPrev;       /**< @brief Команды предыдущего кадра (для сравнения) */
+    std::unique_ptr<TextSegment[]> _listSegments;       /**< @brief Фрагменты текстовых команд */
+    std::unique_ptr<char[]> _listText;                  /**< @brief Копии текста фрагментов */
+    uint8_t _listCapacity;                              /**< @brief Размер _listItems / _listPrev / _listSegments */
+    uint16_t _listTextSize;                             /**< @brief Размер _listText в байтах */
+    uint8_t _listCount;                                 /**< @brief Команд в записываемом кадре */
+    uint8_t _listPrevCount;                             /**< @brief Команд в предыдущем кадре */
+    uint8_t _listSegmentCount;                          /**< @brief Занято фрагментов */
+    uint16_t _listTextUsed;                             /**< @brief Занято байт текста */
+    uint8_t _listRedrawn;                               /**< @brief Команд, нарисованных последним listEnd() */
+    bool _listRecording;                                /**< @brief Идёт запись (примитивы не рисуют) */
+    bool _listValid;                                    /**< @brief Буфер содержит результат предыдущего кадра списка */
+    int16_t _listDirtyX0, _listDirtyY0, _listDirtyX1, _listDirtyY1; /**< @brief Изменённая область последнего listEnd() */
+    int16_t _clipX0, _clipY0, _clipX1, _clipY1;         /**< @brief Окно отсечения примитивов (x1, y1 не включительно) */
+    uint8_t _stripPages;                                /**< @brief Высота полосы pageMode в страницах (0 = полный кадровый буфер) */
+    uint8_t _bufferPage0;                               /**< @brief Первая страница холста, хранящаяся в _buffer */
+    uint8_t _bufferPages;                               /**< @brief Страниц в _buffer (весь холст или полоса) */
+    TaskHandle_t _renderTaskHandle;                     /**< @brief Задача рендера (nullptr - обычный режим) */
+    SemaphoreHandle_t _renderMutex;                     /**< @brief Захват библиотеки: порция команд задачи или рисование очереди */
+    SemaphoreHandle_t _renderDone;                      /**< @brief Сигнал завершения задачи рендера для renderStop() */
+    bool _renderStop;                                   /**< @brief Запрос остановки задачи рендера */
+    bool _listOverflow;                                 /**< @brief В текущей порции команда не поместилась в очередь */
+    uint8_t _frameItems;                                /**< @brief Команд в очереди до текущей порции (для отката) */
+    uint8_t _frameSegments;                             /**< @brief Фрагментов текста до текущей порции */
+    uint16_t _frameText;                                /**< @brief Байт текста до текущей порции */
+    uint32_t _renderFrames;                             /**< @brief Кадров, отправленных задачей рендера */
+    uint32_t _renderDropped;                            /**< @brief Порций, отброшенных при переполнении очереди */
+    static const uint32_t RENDER_TASK_STACK = 8192;     /**< @brief Стек задачи рендера по умолчанию, байт (как у loopTask) */
+    std::unique_ptr<CommandSlot[]> _queueSlots;         /**< @brief Кольцо очереди post() */
+    uint16_t _queueMask;                                /**< @brief Ёмкость очереди - 1 (ёмкость - степень двойки) */
+    std::atomic<uint32_t> _queueHead;                   /**< @brief Следующая позиция записи (общая для всех задач) */
+    std::atomic<uint32_t> _queueTail;                   /**< @brief Следующая позиция чтения (меняет только владелец экрана) */
+    std::atomic<uint32_t> _queueDropped;                /**< @brief Отброшено при заполненной очереди */
+    std::unique_ptr<CommandBox[]> _queueBoxes;          /**< @brief Последние команды виджетов */
+    uint8_t _queueWidgets;                              /**< @brief Количество ячеек виджетов */
+    std::atomic<uint32_t> _queueCoalesced;              /**< @brief Заменено более новыми командами виджета */
+    uint16_t _queuePeak;                                /**< @brief Наибольшая выборка из очереди */
+    std::unique_ptr<SavaOLED_ESP32> _rasterHelper;      /**< @brief Растеризатор нижней полосы: свои буфер строки, курсор, окно отсечения */
+    TaskHandle_t _rasterTaskHandle;                     /**< @brief Задача нижней полосы (nullptr - кадр рисует одно ядро) */
+    SemaphoreHandle_t _rasterDone;                      /**< @brief Сигнал «полоса нарисована» (и завершения задачи) */
+    bool _rasterStop;                                   /**< @brief Запрос остановки задачи нижней полосы */
+    uint8_t _rasterSplit;                               /**< @brief Первая страница нижней полосы текущего кадра */
+    const DisplayListItem* _rasterJobItems;             /**< @brief Команды кадра для задачи нижней полосы */
+    const TextSegment* _rasterJobSegments;              /**< @brief Фрагменты текста команд кадра */
+    const int16_t (*_rasterJobRegions)[4];              /**< @brief Области кадра, которые нужно нарисовать */
+    uint8_t _rasterJobCount;                            /**< @brief Команд в кадре */
+    uint8_t _rasterJobRegionCount;                      /**< @brief Областей в кадре */
+    bool _rasterJobClear;                               /**< @brief Очищать области перед рисованием */
+    uint8_t _rasterJobDrawn;                            /**< @brief Сколько раз задача нижней полосы рисовала команды */
+    static const uint32_t RASTER_TASK_STACK = 8192;     /**< @brief Стек задачи нижней полосы по умолчанию, байт (как у loopTask) */
+    static const uint16_t RASTER_MIN_AREA = 2048;       /**< @brief Меньшая площадь команд кадра рисуется одним ядром */
+    uint8_t* _target;                                   /**< @brief Цель рисования: _buffer, холст canvasBegin или кадр основного ядра */
+    SavaCanvas* _canvasTarget;                          /**< @brief Холст canvasBegin (nullptr - рисование на экран) */
+    uint8_t _screenWidth, _screenHeight;                /**< @brief Размер холста экрана на время canvasBegin */
+    uint8_t _screenPage0, _screenPages;                 /**< @brief _bufferPage0 / _bufferPages экрана на время canvasBegin */
+    std::unique_ptr<SavaLayer[]> _layers;               /**< @brief Слои композиции (layers) */
+    uint8_t _layerCount;                                /**< @brief Количество слоёв (0 - выключены) */
+    uint32_t _layerDirty;                               /**< @brief Страницы кадра для сборки из слоёв: бит N - страница N */
+    uint8_t _composedPages;                             /**< @brief Страниц собрано при последней сборке */
+    std::unique_ptr<uint8_t[]> _overlayPool;            /**< @brief Пул копий кадра под окнами (overlayPool) */
+    std::unique_ptr<OverlaySave[]> _overlaySaves;       /**< @brief Стек сохранённых областей */
+    uint16_t _overlayBytes;                             /**< @brief Размер пула в байтах */
+    uint16_t _overlayUsed;                              /**< @brief Занято байт пула */
+    uint8_t _overlayMax;                                /**< @brief Глубина стека окон */
+    uint8_t _overlayDepth;                              /**< @brief Открыто окон */
+    uint32_t _overlayOverflows;                         /**< @brief Окон, не поместившихся в пул */
 
 	static const uint8_t MAX_SEGMENTS = 8; 				/**< @brief Максимум 8 фрагментов с разными шрифтами на одну строку*/
     static const size_t TEXT_BUFFER_SIZE = 256; 		/**< @brief Общий размер буфера для текста всех фрагментов*/        //было 128
@@ -499,12 +1525,19 @@ private:
     char _textBuffer[TEXT_BUFFER_SIZE];       			/**< @brief Общий буфер для хранения текста всех сегментов */
     size_t _textBufferPos;                    			/**< @brief Текущая позиция в общем текстовом буфере */
     bool _lineChanged;              					/**< @brief Флаг, что текст строки изменился и требует повторного рендера */
+    uint16_t _segmentEnd[MAX_SEGMENTS];                 /**< @brief Правая граница каждого сегмента в _lineBuffer (с интервалом после него) */
+    bool _lineMixedModes;                               /**< @brief В строке есть сегменты с разными режимами отрисовки */
 	
 	uint8_t _charSpacing; 								/**< @brief Межсимвольный интервал в пикселях */
+	uint8_t _textScale; 								/**< @brief Масштаб текста для следующих print (1..4) */
 	uint8_t _drawMode; 									/**< @brief Текущий режим отрисовки (REPLACE, INV_AUTO, ADD_UP) */
 	
-	uint8_t _width;   									/**< @brief Ширина дисплея в пикселях */
-    uint8_t _height;   									/**< @brief Высота дисплея в пикселях */
+	uint8_t _width;   									/**< @brief Ширина холста в пикселях (после canvasRotation) */
+    uint8_t _height;   									/**< @brief Высота холста в пикселях (после canvasRotation) */
+    uint8_t _panelWidth;   								/**< @brief Физическая ширина панели в пикселях */
+    uint8_t _panelHeight;   							/**< @brief Физическая высота панели в пикселях */
+    uint8_t _canvasTurn;   								/**< @brief Поворот холста: ROT_0, ROT_90 или ROT_270 */
+    std::unique_ptr<uint8_t[]> _rotBuffer;              /**< @brief Кадр панели для повёрнутого холста (выделяется по требованию) */
     uint16_t _bufferSize; 								/**< @brief Размер кадрового буфера в байтах (_width * _height / 8) */
 	
     std::unique_ptr<uint8_t[]> _buffer;                 //uint8_t* _buffer;		/**< @brief Кадровый буфер (формат страниц SSD1306) */
@@ -517,8 +1550,120 @@ private:
 
     std::unique_ptr<uint8_t[]> _vertBuffer;             //uint8_t* _vertBuffer; /**< @brief Вертикальный буфер (лента) */        
     uint16_t _vertBufferHeight;                         /**< @brief Текущая высота текста в буфере */
+    uint8_t _vertBufferWidth;                           /**< @brief Ширина ленты в колонках (самый широкий символ) */
+    uint16_t _vertTapePages;                            /**< @brief Высота ленты в страницах (байтах на колонку) */
+    uint32_t _vertSignature;                            /**< @brief Подпись текста, отрисованного в ленту */
+    static const uint8_t MAX_BOX_LINES = 32;            /**< @brief Максимум строк в textBox после переноса */
+    TextBoxLine _boxLines[MAX_BOX_LINES];               /**< @brief Кэш переносов textBox */
+    uint8_t _boxLineCount;                              /**< @brief Количество строк в кэше */
+    uint16_t _boxFirstLine;                             /**< @brief Первая видимая строка (вертикальная прокрутка) */
+    uint32_t _boxSignature;                             /**< @brief Подпись текста и параметров, для которых посчитаны переносы */
+    int16_t _boxX, _boxY, _boxW, _boxH;                 /**< @brief Прямоугольник textBox */
+    uint8_t _boxAlign;                                  /**< @brief Выравнивание строк textBox */
+    uint8_t _boxLineSpacing;                            /**< @brief Отступ между строками textBox */
+    bool _boxWordWrap;                                  /**< @brief Перенос по словам (true) или по символам (false) */
     static const uint16_t VERT_BUF_SIZE = 2048;         /**< @brief Размер (хватит на ~500 пикселей высоты при ширине 32px) */
     
 };
 
+#ifdef SAVAOLED_HAS_PRINTFMT
+//#############################################################################################################################
+// --- Реализация printFmt (шаблоны должны быть в заголовке) ---
+//#############################################################################################################################
+
+template <savaFmt::FixedString Fmt, typename... Args>
+void SavaOLED_ESP32::printFmt(const Args&... args) {
+    static constexpr size_t ARG_COUNT = sizeof...(Args);
+    static constexpr auto layout = savaFmt::parse<Fmt, ARG_COUNT>();
+    static_assert(layout.argCount == ARG_COUNT, "printFmt: число полей {} не совпадает с числом аргументов");
+
+    char* dest = _reserveSegment(0);
+    if (!dest) return;
+    uint16_t cap = _freeTextSpace();
+    uint16_t pos = 0;
+
+    // Литерал перед полем I, затем само поле I
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        ((_fmtPut(dest, cap, pos, layout.text + (I ? layout.litEnd[I - 1] : 0),
+                  layout.litEnd[I] - (I ? layout.litEnd[I - 1] : 0)),
+          _fmtArg<layout.specs[I]>(dest, cap, pos, args)), ...);
+    }(std::index_sequence_for<Args...>{});
+
+    // Хвостовой литерал
+    uint16_t tail = 0;
+    if constexpr (ARG_COUNT > 0) tail = layout.litEnd[ARG_COUNT - 1];
+    _fmtPut(dest, cap, pos, layout.text + tail, layout.textLen - tail);
+
+    if (pos > cap) {
+        OLED_ERROR("Text buffer overflow! Pos: %zu, Need: %u, Max: %zu", _textBufferPos, pos, TEXT_BUFFER_SIZE);
+        return;
+    }
+    _commitSegment(pos);
+}
+
+template <savaFmt::Spec S, typename T>
+void SavaOLED_ESP32::_fmtArg(char* dest, uint16_t cap, uint16_t &pos, const T& value) {
+    // Ширина без '0' — пробелы слева: сначала меряем (cap = 0), затем пишем после отступа
+    auto padded = [&](auto emit) {
+        if (!S.zero && S.width > 0) {
+            uint16_t len = emit(dest, 0);
+            for (; len < S.width; len++) _fmtPut(dest, cap, pos, " ", 1);
+        }
+        uint16_t room = (pos < cap) ? cap - pos : 0;
+        pos += emit(dest + pos, room);
+    };
+
+    if constexpr (std::is_same_v<T, bool>) {
+        static_assert(S.type == 0 && S.precision < 0, "printFmt: для bool допустимо только {}");
+        padded([&](char* d, uint16_t c) -> uint16_t {
+            const char* word = value ? "true" : "false";
+            uint16_t len = value ? 4 : 5;
+            memcpy(d, word, (c < len) ? c : len);
+            return len;
+        });
+    } else if constexpr (std::is_same_v<T, char>) {
+        static_assert(S.type == 0 || S.type == 'c', "printFmt: для char используйте {} или {:c}");
+        padded([&](char* d, uint16_t c) -> uint16_t {
+            if (c) d[0] = value;
+            return 1;
+        });
+    } else if constexpr (std::is_floating_point_v<T>) {
+        static_assert(S.type == 0 || S.type == 'f', "printFmt: для float/double используйте {} или {:.Nf}");
+        constexpr uint8_t decimals = (S.precision < 0) ? 2 : S.precision;
+        constexpr uint8_t zero_width = S.zero ? S.width : 0;
+        padded([&](char* d, uint16_t c) -> uint16_t {
+            if constexpr (sizeof(T) == sizeof(float)) return _emitFloat(d, c, value, decimals, zero_width);
+            else return _emitDouble(d, c, (double)value, decimals, zero_width);
+        });
+    } else if constexpr (std::is_integral_v<T>) {
+        static_assert(S.type == 0 || S.type == 'd', "printFmt: для целых используйте {} или {:Nd}");
+        static_assert(S.precision < 0, "printFmt: точность не применима к целым");
+        static_assert(sizeof(T) <= 4, "printFmt: поддерживаются целые до 32 бит");
+        constexpr uint8_t zero_width = S.zero ? S.width : 0;
+        bool negative = false;
+        uint32_t magnitude = (uint32_t)value;
+        if constexpr (std::is_signed_v<T>) {
+            negative = value < 0;
+            if (negative) magnitude = 0U - (uint32_t)(int32_t)value;
+        }
+        padded([&](char* d, uint16_t c) -> uint16_t {
+            return _emitInteger(d, c, negative, magnitude, zero_width);
+        });
+    } else if constexpr (std::is_convertible_v<const T&, const char*> || requires { value.c_str(); }) {
+        static_assert(S.type == 0 || S.type == 's', "printFmt: для строк используйте {} или {:Ns}");
+        static_assert(S.precision < 0 && !S.zero, "printFmt: для строк допустима только ширина");
+        const char* str;
+        if constexpr (std::is_convertible_v<const T&, const char*>) str = value;
+        else str = value.c_str();
+        uint16_t len = str ? strlen(str) : 0;
+        padded([&](char* d, uint16_t c) -> uint16_t {
+            memcpy(d, str, (c < len) ? c : len);
+            return len;
+        });
+    } else {
+        static_assert(sizeof(T) == 0, "printFmt: неподдерживаемый тип аргумента");
+    }
+}
+#endif // SAVAOLED_HAS_PRINTFMT
+
 #endif // SavaOLED_ESP32_h
\ No newline at end of file
@@ -0,0 +1,106 @@
+#ifndef SAVAOLED_FMT_H
+#define SAVAOLED_FMT_H
+
+// ============================================================
+// Разбор строки формата для printFmt<"...">() на этапе компиляции.
+// Нужен C++20 (строка формата как параметр шаблона).
+// ============================================================
+// Синтаксис поля: {[:[0][ширина][.точность][тип]]}
+//   тип: d - целое, f - float/double, s - строка, c - символ, пусто - по типу аргумента
+//   "{{" и "}}" - литеральные фигурные скобки
+// Примеры: "{}", "{:03d}", "{:.1f}", "{:6.2f}", "{:08.3f}", "{:5s}"
+// Ширина без 0 дополняет пробелами слева, с 0 - нулями после знака (как print(value, min_digits/min_width)).
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if __cplusplus >= 202002L
+#define SAVAOLED_HAS_PRINTFMT 1
+
+namespace savaFmt {
+
+// Строка формата, переданная как параметр шаблона: oled.printFmt<"T: {:.1f}">(t)
+template <size_t N>
+struct FixedString {
+    char str[N] = {};
+    constexpr FixedString(const char (&s)[N]) {
+        for (size_t i = 0; i < N; i++) str[i] = s[i];
+    }
+};
+
+// Описание одного поля {}
+struct Spec {
+    char type = 0;          // 0 (по аргументу), 'd', 'f', 's', 'c'
+    bool zero = false;      // дополнять нулями (после знака)
+    uint8_t width = 0;      // минимальная ширина
+    int8_t precision = -1;  // знаков после запятой (-1 = по умолчанию, 2)
+};
+
+// Результат разбора: литеральный текст (без экранирования) и поля между его кусками
+template <size_t N, size_t A>
+struct Layout {
+    char text[N] = {};              // все литералы подряд
+    uint16_t textLen = 0;
+    uint16_t litEnd[A + 1] = {};    // конец литерала перед полем i (litEnd[A] = textLen)
+    Spec specs[A ? A : 1] = {};
+    uint8_t argCount = 0;
+};
+
+// Вызов не-constexpr функции в consteval-контексте = ошибка компиляции с понятным именем
+void printFmt_error_unbalanced_brace();
+void printFmt_error_too_many_fields();
+void printFmt_error_bad_spec();
+
+template <FixedString Fmt, size_t A>
+consteval Layout<sizeof(Fmt.str), A> parse() {
+    Layout<sizeof(Fmt.str), A> layout;
+    const char* s = Fmt.str;
+    size_t i = 0;
+    while (s[i] != '\0') {
+        char c = s[i];
+        if (c == '{' && s[i + 1] == '{') { layout.text[layout.textLen++] = '{'; i += 2; continue; }
+        if (c == '}' && s[i + 1] == '}') { layout.text[layout.textLen++] = '}'; i += 2; continue; }
+        if (c == '}') printFmt_error_unbalanced_brace();
+        if (c != '{') { layout.text[layout.textLen++] = c; i++; continue; }
+
+        // --- Поле {...} ---
+        if (layout.argCount >= A) printFmt_error_too_many_fields();
+        Spec spec;
+        i++;
+        if (s[i] == ':') {
+            i++;
+            if (s[i] == '0') { spec.zero = true; i++; }
+            // Проверка на каждой цифре: длинное число не успевает переполнить счётчик и обойти предел
+            uint32_t width = 0;
+            while (s[i] >= '0' && s[i] <= '9') {
+                width = width * 10 + (s[i++] - '0');
+                if (width > 255) printFmt_error_bad_spec();
+            }
+            spec.width = width;
+            if (s[i] == '.') {
+                i++;
+                if (s[i] < '0' || s[i] > '9') printFmt_error_bad_spec();
+                uint32_t precision = 0;
+                while (s[i] >= '0' && s[i] <= '9') {
+                    precision = precision * 10 + (s[i++] - '0');
+                    if (precision > 9) printFmt_error_bad_spec();
+                }
+                spec.precision = precision;
+            }
+            if (s[i] == 'd' || s[i] == 'f' || s[i] == 's' || s[i] == 'c') spec.type = s[i++];
+        }
+        if (s[i] != '}') printFmt_error_bad_spec();
+        i++;
+        layout.litEnd[layout.argCount] = layout.textLen;
+        layout.specs[layout.argCount] = spec;
+        layout.argCount++;
+    }
+    layout.litEnd[A] = layout.textLen;
+    return layout;
+}
+
+} // namespace savaFmt
+
+#endif // __cplusplus >= 202002L
+
+#endif // SAVAOLED_FMT_H
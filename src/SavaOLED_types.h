@@ -34,6 +34,45 @@
 #define ERASE 3
 #define ERASE_BORDER 4
 
+// Старший бит байта ширины символа: данные символа сжаты RLE (extras/tools/sava_font_rle.py)
+#define FONT_RLE_FLAG 0x80
+
+// Поворот логического холста (canvasRotation)
+#define ROT_0   0
+#define ROT_90  1
+#define ROT_270 3
+
+// Типы команд списка отображения (DisplayListItem::type)
+#define DL_DOT        0
+#define DL_LINE       1
+#define DL_RECT       2
+#define DL_RECT_R     3
+#define DL_CIRCLE     4
+#define DL_BEZIER     5
+#define DL_BITMAP     6
+#define DL_BITMAP_RLE 7
+#define DL_TEXT       8
+#define DL_CANVAS     9
+
+// Типы команд очереди (SavaCommand::type, см. post)
+#define CMD_DOT        0
+#define CMD_LINE       1
+#define CMD_RECT       2
+#define CMD_CIRCLE     3
+#define CMD_BITMAP     4
+#define CMD_BITMAP_RLE 5
+#define CMD_TEXT       6
+#define CMD_NUMBER     7
+#define SAVA_CMD_TEXT  16   // Байт текста в команде CMD_TEXT (с нулём в конце)
+
+// Композиция слоёв (см. layers)
+#define SAVA_MAX_LAYERS 4   // Наибольшее число слоёв
+
+// Стиль графика (см. chartWidget)
+#define CHART_LINE 0        // Линия: соседние отсчёты соединены
+#define CHART_BAR  1        // Столбики от низа области
+#define CHART_DOT  2        // Точки
+
 #define FULL_FRAME true
 #define PAGES_FRAME false
 